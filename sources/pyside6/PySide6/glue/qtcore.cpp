@@ -268,6 +268,16 @@ PyModule_AddStringConstant(module, "__version__", qVersion());
 %PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](%0);
 // @snippet qobject-connect-6
 
+// @snippet qobject-connectmany
+// %FUNCTION_NAME() - disable generation of function call.
+const QList<QMetaObject::Connection> connections = PySide::qobjectConnectMany(%PYARG_1, %2);
+if (PyErr_Occurred() == nullptr) {
+    %PYARG_0 = PyList_New(connections.size());
+    for (qsizetype i = 0, size = connections.size(); i < size; ++i)
+        PyList_SET_ITEM(%PYARG_0, i, %CONVERTTOPYTHON[QMetaObject::Connection](connections.at(i)));
+}
+// @snippet qobject-connectmany
+
 // @snippet qobject-emit
 %RETURN_TYPE %0 = PySide::SignalManager::instance().emitSignal(%CPPSELF, %1, %PYARG_2);
 %PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](%0);
@@ -285,6 +295,16 @@ PyModule_AddStringConstant(module, "__version__", qVersion());
 %PYARG_0 = %CONVERTTOPYTHON[%RETURN_TYPE](%0);
 // @snippet qobject-disconnect-2
 
+// @snippet qobject-disconnectmany
+// %FUNCTION_NAME() - disable generation of function call.
+const QList<bool> disconnected = PySide::qobjectDisconnectMany(%PYARG_1);
+if (PyErr_Occurred() == nullptr) {
+    %PYARG_0 = PyList_New(disconnected.size());
+    for (qsizetype i = 0, size = disconnected.size(); i < size; ++i)
+        PyList_SET_ITEM(%PYARG_0, i, %CONVERTTOPYTHON[bool](disconnected.at(i)));
+}
+// @snippet qobject-disconnectmany
+
 // @snippet qfatal
 // qFatal doesn't have a stream version, so we do a
 // qWarning call followed by a qFatal() call using a
@@ -182,26 +182,15 @@ inline PyObject *addMenuActionWithPyObject(QMenu *self, const QIcon &icon,
 // @snippet qwidget-addaction-4
 
 // @snippet qmenu-clear
-Shiboken::BindingManager &bm = Shiboken::BindingManager::instance();
 const auto &actions = %CPPSELF.actions();
-for (auto *act : actions) {
-    if (auto wrapper = bm.retrieveWrapper(act)) {
-        auto pyObj = reinterpret_cast<PyObject *>(wrapper);
-        Py_INCREF(pyObj);
-        Shiboken::Object::setParent(nullptr, pyObj);
-        Shiboken::Object::invalidate(pyObj);
-        Py_DECREF(pyObj);
-    }
-}
+Shiboken::Object::detachWrappers(reinterpret_cast<const void *const *>(actions.constData()),
+                                 actions.size());
 // @snippet qmenu-clear
 
 // @snippet qmenubar-clear
 const auto &actions = %CPPSELF.actions();
-for (auto *act : actions) {
-  Shiboken::AutoDecRef pyAct(%CONVERTTOPYTHON[QAction *](act));
-  Shiboken::Object::setParent(nullptr, pyAct);
-  Shiboken::Object::invalidate(pyAct);
-}
+Shiboken::Object::detachWrappers(reinterpret_cast<const void *const *>(actions.constData()),
+                                 actions.size());
 // @snippet qmenubar-clear
 
 // @snippet qtoolbox-removeitem
@@ -216,29 +205,59 @@ if (_widget) {
 void addLayoutOwnership(QLayout *layout, QLayoutItem *item);
 void removeLayoutOwnership(QLayout *layout, QWidget *widget);
 
+// Check the parent relations recorded by setParentOfPointer() when the
+// child gets a wrapper, it may have been deleted and another object
+// created at its address meanwhile.
+template <class Parent>
+static inline Parent *parentPointer(PyObject *parent)
+{
+    if (!Shiboken::Object::isValid(parent, false))
+        return nullptr;
+    return reinterpret_cast<Parent *>(
+        Shiboken::Object::cppPointer(reinterpret_cast<SbkObject *>(parent),
+                                     Shiboken::SbkType<Parent>()));
+}
+
+static bool isChildWidget(PyObject *parent, const void *cptr)
+{
+    const QWidget *parentWidget = parentPointer<QWidget>(parent);
+    return parentWidget != nullptr
+        && static_cast<const QWidget *>(cptr)->parentWidget() == parentWidget;
+}
+
+static bool isChildLayout(PyObject *parent, const void *cptr)
+{
+    const QLayout *parentLayout = parentPointer<QLayout>(parent);
+    return parentLayout != nullptr && static_cast<const QLayout *>(cptr)->parent() == parentLayout;
+}
+
+static bool isLayoutItem(PyObject *parent, const void *cptr)
+{
+    const QLayout *layout = parentPointer<QLayout>(parent);
+    return layout != nullptr && layout->indexOf(static_cast<const QLayoutItem *>(cptr)) != -1;
+}
+
 inline void addLayoutOwnership(QLayout *layout, QWidget *widget)
 {
     //transfer ownership to parent widget
     QWidget *lw = layout->parentWidget();
     QWidget *pw = widget->parentWidget();
 
-   Shiboken::AutoDecRef pyChild(%CONVERTTOPYTHON[QWidget *](widget));
-
-    //Transfer parent to layout widget
-    if (pw && lw && pw != lw)
-        Shiboken::Object::setParent(nullptr, pyChild);
-
     if (!lw && !pw) {
         //keep the reference while the layout is orphan
+        Shiboken::AutoDecRef pyChild(%CONVERTTOPYTHON[QWidget *](widget));
         Shiboken::AutoDecRef pyParent(%CONVERTTOPYTHON[QWidget *](layout));
         Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(pyParent.object()),
                                         retrieveObjectName(pyParent).constData(),
                                         pyChild, true);
     } else {
+        //Transfer parent to layout widget, a widget without wrapper gets
+        //it when it is first seen from Python
         if (!lw)
             lw = pw;
         Shiboken::AutoDecRef pyParent(%CONVERTTOPYTHON[QWidget *](lw));
-        Shiboken::Object::setParent(pyParent, pyChild);
+        Shiboken::Object::setParentOfPointer(pyParent, Shiboken::SbkType<QWidget>(), widget,
+                                             isChildWidget);
     }
 }
 
@@ -264,8 +283,8 @@ inline void addLayoutOwnership(QLayout *layout, QLayout *other)
     }
 
     Shiboken::AutoDecRef pyParent(%CONVERTTOPYTHON[QLayout *](layout));
-    Shiboken::AutoDecRef pyChild(%CONVERTTOPYTHON[QLayout *](other));
-    Shiboken::Object::setParent(pyParent, pyChild);
+    Shiboken::Object::setParentOfPointer(pyParent, Shiboken::SbkType<QLayout>(), other,
+                                         isChildLayout);
 }
 
 inline void addLayoutOwnership(QLayout *layout, QLayoutItem *item)
@@ -281,8 +300,8 @@ inline void addLayoutOwnership(QLayout *layout, QLayoutItem *item)
     }
 
     Shiboken::AutoDecRef pyParent(%CONVERTTOPYTHON[QLayout *](layout));
-    Shiboken::AutoDecRef pyChild(%CONVERTTOPYTHON[QLayoutItem *](item));
-    Shiboken::Object::setParent(pyParent, pyChild);
+    Shiboken::Object::setParentOfPointer(pyParent, Shiboken::SbkType<QLayoutItem>(), item,
+                                         isLayoutItem);
 }
 
 static void removeWidgetFromLayout(QLayout *layout, QWidget *widget)
@@ -290,9 +309,9 @@ static void removeWidgetFromLayout(QLayout *layout, QWidget *widget)
     if (QWidget *parent = widget->parentWidget()) {
         //give the ownership to parent
         Shiboken::AutoDecRef pyParent(%CONVERTTOPYTHON[QWidget *](parent));
-        Shiboken::AutoDecRef pyChild(%CONVERTTOPYTHON[QWidget *](widget));
-        Shiboken::Object::setParent(pyParent, pyChild);
-    } else {
+        Shiboken::Object::setParentOfPointer(pyParent, Shiboken::SbkType<QWidget>(), widget,
+                                             isChildWidget);
+    } else if (Shiboken::BindingManager::instance().hasWrapper(widget)) {
         //remove reference on layout
         Shiboken::AutoDecRef pyParent(%CONVERTTOPYTHON[QWidget *](layout));
         Shiboken::AutoDecRef pyChild(%CONVERTTOPYTHON[QWidget *](widget));
@@ -312,6 +331,12 @@ inline void removeLayoutOwnership(QLayout *layout, QLayoutItem *item)
             removeLayoutOwnership(layout, l);
     }
 
+    // An item without wrapper only needs its recorded parent to be dropped
+    if (!Shiboken::BindingManager::instance().hasWrapper(item)) {
+        Shiboken::Object::setParentOfPointer(nullptr, Shiboken::SbkType<QLayoutItem>(), item,
+                                             nullptr);
+        return;
+    }
     Shiboken::AutoDecRef pyChild(%CONVERTTOPYTHON[QLayoutItem *](item));
     Shiboken::Object::invalidate(pyChild);
     Shiboken::Object::setParent(0, pyChild);
@@ -381,34 +406,23 @@ Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(%PYARG_0), "setWid
 
 // @snippet qgraphicsscene-clear
 const QList<QGraphicsItem *> items = %CPPSELF.items();
-Shiboken::BindingManager &bm = Shiboken::BindingManager::instance();
-for (auto *item : items) {
-    SbkObject *obj = bm.retrieveWrapper(item);
-    if (obj) {
-        if (reinterpret_cast<PyObject *>(obj)->ob_refcnt > 1) // If the refcnt is 1 the object will vannish anyway.
-            Shiboken::Object::invalidate(obj);
-        Shiboken::Object::removeParent(obj);
-    }
-}
+Shiboken::Object::detachWrappers(reinterpret_cast<const void *const *>(items.constData()),
+                                 items.size());
 %CPPSELF.%FUNCTION_NAME();
 // @snippet qgraphicsscene-clear
 
 // @snippet qtreewidget-clear
 QTreeWidgetItem *rootItem = %CPPSELF.invisibleRootItem();
-Shiboken::BindingManager &bm = Shiboken::BindingManager::instance();
-
-// PYSIDE-1251:
-// Since some objects can be created with a parent and without
-// being saved on a local variable (refcount = 1), they will be
-// deleted when setting the parent to nullptr, so we change the loop
-// to do this from the last child to the first, to avoid the case
-// when the child(1) points to the original child(2) in case the
-// first one was removed.
-for (int i = rootItem->childCount() - 1; i >= 0; --i) {
-    QTreeWidgetItem *item = rootItem->child(i);
-    if (SbkObject *wrapper = bm.retrieveWrapper(item))
-        Shiboken::Object::setParent(nullptr, reinterpret_cast<PyObject *>(wrapper));
-}
+// PYSIDE-1251: Some objects can be created with a parent and without being
+// saved on a local variable (refcount = 1). They are deleted when removing
+// the parent, so the children are collected first.
+const int childCount = rootItem->childCount();
+QList<QTreeWidgetItem *> items;
+items.reserve(childCount);
+for (int i = 0; i < childCount; ++i)
+    items.append(rootItem->child(i));
+Shiboken::Object::detachWrappers(reinterpret_cast<const void *const *>(items.constData()),
+                                 items.size(), false);
 // @snippet qtreewidget-clear
 
 // @snippet qtreewidgetitem
@@ -419,17 +433,13 @@ if (%0)
 // @snippet qtreewidgetitem
 
 // @snippet qlistwidget-clear
-Shiboken::BindingManager &bm = Shiboken::BindingManager::instance();
-for (int i = 0, count = %CPPSELF.count(); i < count; ++i) {
-    QListWidgetItem *item = %CPPSELF.item(i);
-    if (auto wrapper = bm.retrieveWrapper(item)) {
-        auto pyObj = reinterpret_cast<PyObject *>(wrapper);
-        Py_INCREF(pyObj);
-        Shiboken::Object::setParent(nullptr, pyObj);
-        Shiboken::Object::invalidate(pyObj);
-        Py_DECREF(pyObj);
-    }
-}
+const int count = %CPPSELF.count();
+QList<QListWidgetItem *> items;
+items.reserve(count);
+for (int i = 0; i < count; ++i)
+    items.append(%CPPSELF.item(i));
+Shiboken::Object::detachWrappers(reinterpret_cast<const void *const *>(items.constData()),
+                                 items.size());
 %CPPSELF.%FUNCTION_NAME();
 // @snippet qlistwidget-clear
 
@@ -605,11 +615,8 @@ for (auto *child : toolButtonChildren) {
 
 //Remove actions
 const auto &actions = %CPPSELF.actions();
-for (auto *act : actions) {
-    Shiboken::AutoDecRef pyAct(%CONVERTTOPYTHON[QAction *](act));
-    Shiboken::Object::setParent(nullptr, pyAct);
-    Shiboken::Object::invalidate(pyAct);
-}
+Shiboken::Object::detachWrappers(reinterpret_cast<const void *const *>(actions.constData()),
+                                 actions.size());
 
 %CPPSELF.clear();
 for (auto *obj : qAsConst(lst)) {
@@ -150,6 +150,17 @@ macro(create_pyside_module)
         list(APPEND shiboken_command "\"--drop-type-entries=${dropped_entries}\"")
     endif()
 
+    # When caching the translation units parsed by clang, the headers of the
+    # dependencies are precompiled once and shared between the modules.
+    if(SHIBOKEN_CLANG_CACHE_DIR AND ${module_DEPS})
+        set(base_header_list "")
+        foreach(dep ${${module_DEPS}})
+            list(APPEND base_header_list "${pyside6_BINARY_DIR}/${dep}_global.h")
+        endforeach()
+        make_path(base_headers ${base_header_list})
+        list(APPEND shiboken_command "--clang-cache-base-headers=${base_headers}")
+    endif()
+
     list(APPEND shiboken_command "${pyside6_BINARY_DIR}/${module_NAME}_global.h"
          ${typesystem_path})
 
@@ -222,6 +222,11 @@ set(GENERATOR_EXTRA_FLAGS --generator-set=shiboken
                           --use-isnull-as-nb_nonzero)
 use_protected_as_public_hack()
 
+# Reuse the translation units parsed by clang when regenerating.
+if(SHIBOKEN_CLANG_CACHE_DIR)
+    list(APPEND GENERATOR_EXTRA_FLAGS "--clang-cache-directory=${SHIBOKEN_CLANG_CACHE_DIR}")
+endif()
+
 # Build with Address sanitizer enabled if requested. This may break things, so use at your own risk.
 if(SANITIZE_ADDRESS AND NOT MSVC)
     setup_sanitize_address()
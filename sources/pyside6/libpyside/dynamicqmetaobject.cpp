@@ -112,8 +112,12 @@ MetaObjectBuilder::MetaObjectBuilder(PyTypeObject *type, const QMetaObject *meta
 
 MetaObjectBuilder::~MetaObjectBuilder()
 {
-    for (auto *metaObject : m_d->m_cachedMetaObjects)
+    for (auto *metaObject : m_d->m_cachedMetaObjects) {
+        // The address of the meta object may be reused.
+        clearMissingAttributeCache(metaObject);
+        clearSlotCallCache(metaObject);
         free(const_cast<QMetaObject*>(metaObject));
+    }
     delete m_d->m_builder;
     delete m_d;
 }
@@ -260,12 +260,14 @@ static bool createNewFeatureSet(PyTypeObject *type, int select_id)
     return true;
 }
 
-static inline void SelectFeatureSetSubtype(PyTypeObject *type, int select_id)
+static inline bool SelectFeatureSetSubtype(PyTypeObject *type, int select_id)
 {
     /*
      * This is the selector for one sublass. We need to call this for
      * every subclass until no more subclasses or reaching the wanted id.
+     * Returns true if the dict of the type was switched.
      */
+    auto *initial_dict = type->tp_dict;
     if (Py_TYPE(type->tp_dict) == Py_TYPE(PyType_Type.tp_dict)) {
         // On first touch, we initialize the dynamic naming.
         // The dict type will be replaced after the first call.
@@ -277,11 +279,16 @@ static inline void SelectFeatureSetSubtype(PyTypeObject *type, int select_id)
     if (!moveToFeatureSet(type, select_id)) {
         if (!createNewFeatureSet(type, select_id)) {
             Py_FatalError("failed to create a new feature set!");
-            return;
+            return false;
         }
     }
+    return type->tp_dict != initial_dict;
 }
 
+// The version of the feature sets. It changes whenever the dict of any type
+// is switched, which invalidates the select ids stored in the types.
+static unsigned feature_set_version = 1;
+
 static PyObject *cached_globals{};
 static int last_select_id{};
 
@@ -326,27 +333,29 @@ static inline void SelectFeatureSet(PyTypeObject *type)
             Py_FatalError("failed to replace class dict!");
             return;
         }
+        ++feature_set_version;
+        PyType_Modified(type);
     }
 
     int select_id = getFeatureSelectId();
-    static int last_select_id{};
-    static PyTypeObject *last_type{};
 
-    // PYSIDE-2029: Implement a very simple but effective cache that cannot fail.
-    if (type == last_type && select_id == last_select_id)
+    // PYSIDE-2029: Each type remembers the feature set installed along its
+    // MRO, so alternating between types does not switch the dicts again.
+    if (SbkObjectType_GetSelectId(type, feature_set_version) == select_id)
         return;
-    last_type = type;
-    last_select_id = select_id;
 
     auto *mro = type->tp_mro;
     Py_ssize_t idx, n = PyTuple_GET_SIZE(mro);
     // We leave 'Shiboken.Object' and 'object' alone, therefore "n - 2".
     for (idx = 0; idx < n - 2; idx++) {
         auto *sub_type = reinterpret_cast<PyTypeObject *>(PyTuple_GET_ITEM(mro, idx));
-        SelectFeatureSetSubtype(sub_type, select_id);
+        if (SelectFeatureSetSubtype(sub_type, select_id)) {
+            ++feature_set_version;
+            // PYSIDE-1436: Clear all caches for the type and subtypes.
+            PyType_Modified(sub_type);
+        }
     }
-    // PYSIDE-1436: Clear all caches for the type and subtypes.
-    PyType_Modified(type);
+    SbkObjectType_SetSelectId(type, select_id, feature_set_version);
 }
 
 // For cppgenerator:
@@ -422,6 +431,17 @@ void Enable(bool enable)
 // basewrapper.cpp file.
 //
 
+static PyObject *methodDescriptor(PyTypeObject *type, PyMethodDef *meth)
+{
+    if (meth->ml_flags & METH_STATIC) {
+        AutoDecRef cfunc(PyCFunction_NewEx(meth, reinterpret_cast<PyObject *>(type), nullptr));
+        if (cfunc.isNull())
+            return nullptr;
+        return PyStaticMethod_New(cfunc);
+    }
+    return PyDescr_NewMethod(type, meth);
+}
+
 static PyObject *methodWithNewName(PyTypeObject *type,
                                    PyMethodDef *meth,
                                    const char *new_name)
@@ -429,7 +449,6 @@ static PyObject *methodWithNewName(PyTypeObject *type,
     /*
      * Create a method with a lower case name.
      */
-    auto *obtype = reinterpret_cast<PyObject *>(type);
     int len = strlen(new_name);
     auto name = new char[len + 1];
     strcpy(name, new_name);
@@ -438,17 +457,7 @@ static PyObject *methodWithNewName(PyTypeObject *type,
     new_meth->ml_meth = meth->ml_meth;
     new_meth->ml_flags = meth->ml_flags;
     new_meth->ml_doc = meth->ml_doc;
-    PyObject *descr = nullptr;
-    if (new_meth->ml_flags & METH_STATIC) {
-        AutoDecRef cfunc(PyCFunction_NewEx(new_meth, obtype, nullptr));
-        if (cfunc.isNull())
-            return nullptr;
-        descr = PyStaticMethod_New(cfunc);
-    }
-    else {
-        descr = PyDescr_NewMethod(type, new_meth);
-    }
-    return descr;
+    return methodDescriptor(type, new_meth);
 }
 
 static bool feature_01_addLowerNames(PyTypeObject *type, PyObject *prev_dict, int /* id */)
@@ -478,7 +487,19 @@ static bool feature_01_addLowerNames(PyTypeObject *type, PyObject *prev_dict, in
     }
 
     // Then we walk over the tp_methods to get all methods and insert
-    // them with changed names.
+    // them with changed names. The generator provides a copy of them
+    // with the names converted already.
+
+    if (PyMethodDef *snakeMeth = SbkObjectType_GetSnakeCaseMethods(type)) {
+        for (; snakeMeth->ml_name != nullptr; ++snakeMeth) {
+            AutoDecRef new_method(methodDescriptor(type, snakeMeth));
+            if (new_method.isNull())
+                return false;
+            if (PyDict_SetItemString(lower_dict, snakeMeth->ml_name, new_method) < 0)
+                return false;
+        }
+        return true;
+    }
 
     for (; meth != nullptr && meth->ml_name != nullptr; ++meth) {
         const char *name = String::toCString(String::getSnakeCaseName(meth->ml_name, true));
@@ -601,14 +622,17 @@ PyObject *adjustPropertyName(PyObject *dict, PyObject *name)
     return name;
 }
 
-static QByteArrayList GetPropertyStringsMro(PyTypeObject *type)
+// A property string and its snake_case version written by the generator, if any.
+using PropertyStrings = std::pair<const char *, const char *>;
+
+static QList<PropertyStrings> GetPropertyStringsMro(PyTypeObject *type)
 {
     /*
      * PYSIDE-2042: There are possibly more methods which should become properties,
      *              because the wrapping process does not obey inheritance.
      *              Therefore, we need to walk the mro to find property strings.
      */
-    auto res = QByteArrayList();
+    QList<PropertyStrings> res;
 
     PyObject *mro = type->tp_mro;
     Py_ssize_t idx, n = PyTuple_GET_SIZE(mro);
@@ -616,13 +640,23 @@ static QByteArrayList GetPropertyStringsMro(PyTypeObject *type)
     for (idx = 0; idx < n - 2; idx++) {
         auto *subType = reinterpret_cast<PyTypeObject *>(PyTuple_GET_ITEM(mro, idx));
         auto props = SbkObjectType_GetPropertyStrings(subType);
-        if (props != nullptr)
+        auto snakeProps = SbkObjectType_GetSnakeCasePropertyStrings(subType);
+        if (props != nullptr) {
             for (; *props != nullptr; ++props)
-                res << QByteArray(*props);
+                res.append({*props, snakeProps != nullptr ? *snakeProps++ : nullptr});
+        }
     }
     return res;
 }
 
+// PYSIDE-1019: A std setter has no explicit name in the property string "name:read:".
+static inline bool isStdWriteProperty(const char *propStr)
+{
+    const char *firstColon = strchr(propStr, ':');
+    const size_t len = strlen(propStr);
+    return propStr[len - 1] == ':' && propStr + len - 1 != firstColon;
+}
+
 static bool feature_02_true_property(PyTypeObject *type, PyObject *prev_dict, int id)
 {
     /*
@@ -656,13 +690,21 @@ static bool feature_02_true_property(PyTypeObject *type, PyObject *prev_dict, in
     if (props.isEmpty())
         return true;
 
-    for (const auto &propStr : std::as_const(props)) {
+    for (const auto &[propStr, snakePropStr] : std::as_const(props)) {
         bool isStdWrite;
-        auto fields = parseFields(propStr, &isStdWrite);
+        QByteArrayList fields;
+        // The snake_case names spelled out by the generator need no conversion.
+        const bool convert = lower && snakePropStr == nullptr;
+        if (lower && !convert) {
+            fields = parseFields(snakePropStr, nullptr);
+            isStdWrite = isStdWriteProperty(propStr);
+        } else {
+            fields = parseFields(propStr, &isStdWrite);
+        }
         bool haveWrite = fields.size() == 3;
-        PyObject *name = make_snake_case(fields[0], lower);
-        PyObject *read = make_snake_case(fields[1], lower);
-        PyObject *write = haveWrite ? make_snake_case(fields[2], lower) : nullptr;
+        PyObject *name = make_snake_case(fields[0], convert);
+        PyObject *read = make_snake_case(fields[1], convert);
+        PyObject *write = haveWrite ? make_snake_case(fields[2], convert) : nullptr;
         PyObject *getter = PyDict_GetItem(prev_dict, read);
         if (getter == nullptr || !(Py_TYPE(getter) == PepMethodDescr_TypePtr ||
                                    Py_TYPE(getter) == PepStaticMethod_TypePtr))
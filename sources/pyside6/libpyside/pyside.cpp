@@ -38,6 +38,7 @@
 #include <QtCore/QDir>
 #include <QtCore/QFileInfo>
 #include <QtCore/QMutex>
+#include <QtCore/QSet>
 #include <QtCore/QSharedPointer>
 #include <QtCore/QStack>
 #include <QtCore/QThread>
@@ -490,11 +491,52 @@ void initQApp()
     setDestroyQApplication(destroyQCoreApplication);
 }
 
-PyObject *getHiddenDataFromQObject(QObject *cppSelf, PyObject *self, PyObject *name)
+// Attributes which were neither found by the generic lookup nor in the meta
+// object, so that probing for them (hasattr(), getattr() with a default) does
+// not scan the meta object each time. The entries depend on the type (Python
+// properties), the meta object and the selected feature. The generic lookup
+// precedes the cache, so it cannot hide attributes added later to the type or
+// instance. Protected by the GIL.
+struct MissingAttribute
+{
+    PyTypeObject *type;
+    int flags;
+    QByteArray name;
+};
+
+static bool operator==(const MissingAttribute &a1, const MissingAttribute &a2)
+{
+    return a1.type == a2.type && a1.flags == a2.flags && a1.name == a2.name;
+}
+
+static size_t qHash(const MissingAttribute &a, size_t seed = 0)
+{
+    return qHashMulti(seed, a.type, a.flags, a.name);
+}
+
+// Keyed by meta object, so that the entries of a meta object can be removed
+// when it is freed, see MetaObjectBuilder. A new meta object built for a
+// type gets a new address and starts with no entries.
+static QHash<const QMetaObject *, QSet<MissingAttribute>> missingAttributes;
+
+// Limit of the names per meta object, in case attribute names are generated
+static constexpr qsizetype maxMissingAttributes = 1024;
+
+void clearMissingAttributeCache(const QMetaObject *metaObject)
+{
+    missingAttributes.remove(metaObject);
+}
+
+// Returns whether PyObject_GenericGetAttr() can find \a name, so that it is
+// not called to raise an AttributeError which would be discarded.
+// Same as getHiddenDataFromQObject(), but returns nullptr without setting an
+// AttributeError if the attribute does not exist.
+static PyObject *lookupHiddenDataFromQObject(QObject *cppSelf, PyObject *self, PyObject *name)
 {
     using Shiboken::AutoDecRef;
 
-    PyObject *attr = PyObject_GenericGetAttr(self, name);
+    PyObject *attr = Shiboken::Object::hasGenericAttribute(self, name)
+        ? PyObject_GenericGetAttr(self, name) : nullptr;
     if (!Shiboken::Object::isValid(reinterpret_cast<SbkObject *>(self), false))
         return attr;
 
@@ -524,6 +566,16 @@ PyObject *getHiddenDataFromQObject(QObject *cppSelf, PyObject *self, PyObject *n
         int snake_flag = flags & 0x01;
         int propFlag = flags & 0x02;
 
+        const char *cname = Shiboken::String::toCString(name);
+        uint cnameLen = qstrlen(cname);
+        const QMetaObject *metaObject = cppSelf->metaObject();
+        MissingAttribute missing{Py_TYPE(self), flags, QByteArray::fromRawData(cname, cnameLen)};
+        auto missingIt = missingAttributes.constFind(metaObject);
+        if (missingIt != missingAttributes.cend() && missingIt->contains(missing)) {
+            PyErr_Restore(type, value, traceback);
+            return nullptr;
+        }
+
         if (propFlag) {
             // PYSIDE-1889: If we have actually a Python property, return f(get|set|del).
             //              Do not store this attribute in the instance dict, because this
@@ -554,10 +606,7 @@ PyObject *getHiddenDataFromQObject(QObject *cppSelf, PyObject *self, PyObject *n
             }
         }
 
-        const char *cname = Shiboken::String::toCString(name);
-        uint cnameLen = qstrlen(cname);
         if (std::strncmp("__", cname, 2)) {
-            const QMetaObject *metaObject = cppSelf->metaObject();
             QList<QMetaMethod> signalList;
             // Caution: This inserts a meta function or a signal into the instance dict.
             for (int i=0, imax = metaObject->methodCount(); i < imax; i++) {
@@ -591,11 +640,25 @@ PyObject *getHiddenDataFromQObject(QObject *cppSelf, PyObject *self, PyObject *n
                 return pySignal;
             }
         }
+        auto &missingOfMetaObject = missingAttributes[metaObject];
+        if (missingOfMetaObject.size() >= maxMissingAttributes)
+            missingOfMetaObject.clear();
+        missing.name = QByteArray(cname, cnameLen); // Deep copy of the name
+        missingOfMetaObject.insert(missing);
         PyErr_Restore(type, value, traceback);
     }
     return attr;
 }
 
+PyObject *getHiddenDataFromQObject(QObject *cppSelf, PyObject *self, PyObject *name)
+{
+    PyObject *attr = lookupHiddenDataFromQObject(cppSelf, self, name);
+    // Let the generic function raise the AttributeError for missing attributes.
+    if (attr == nullptr && PyErr_Occurred() == nullptr)
+        return PyObject_GenericGetAttr(self, name);
+    return attr;
+}
+
 // PYSIDE-1889: Keeping the old, misleading API for a while.
 PyObject *getMetaDataFromQObject(QObject *cppSelf, PyObject *self, PyObject *name)
 {
@@ -23,6 +23,13 @@ struct TypeUserData
 
 TypeUserData *retrieveTypeUserData(PyTypeObject *pyTypeObj);
 TypeUserData *retrieveTypeUserData(PyObject *pyObj);
+// Remove the entries of \a metaObject from the cache of attributes not found
+// by getHiddenDataFromQObject(), to be called before it is freed.
+void clearMissingAttributeCache(const QMetaObject *metaObject);
+// Clear the data of Python slots cached by the SignalManager, all of it or
+// that of \a metaObject, to be called before it is freed.
+void clearSlotCallCache();
+void clearSlotCallCache(const QMetaObject *metaObject);
 // For QML
 PYSIDE_API const QMetaObject *retrieveMetaObject(PyTypeObject *pyTypeObj);
 PYSIDE_API const QMetaObject *retrieveMetaObject(PyObject *pyObj);
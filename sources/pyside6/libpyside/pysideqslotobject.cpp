@@ -0,0 +1,236 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "pysideqslotobject_p.h"
+#include "pysidestaticstrings.h"
+#include "pysideutils.h"
+#include "pysideweakref.h"
+
+#include <autodecref.h>
+#include <gilstate.h>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QMetaMethod>
+#include <QtCore/QMutex>
+#include <QtCore/QObject>
+#include <QtCore/QThread>
+#include <private/qobject_p.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace PySide
+{
+
+// Receiver contexts of connections to callables which do not belong to a
+// QObject. As the GlobalReceiverV2 they replace, they live in the connecting
+// thread so that Qt::AutoConnection invokes the callable there (PYSIDE-1354).
+// They are never deleted, so that the connections remain when the thread
+// exits; they are then moved to the main thread. Disconnecting without a
+// context looks at all of them; Qt treats a null receiver as "any receiver".
+static QMutex threadContextsMutex;
+static std::vector<const QObject *> threadContexts;
+
+static const QObject *currentThreadContext()
+{
+    static thread_local QObject *result = nullptr;
+    if (result == nullptr) {
+        auto *context = new QObject;
+        QObject::connect(QThread::currentThread(), &QThread::finished, context, [context] {
+            if (auto *app = QCoreApplication::instance())
+                context->moveToThread(app->thread());
+        }, Qt::DirectConnection);
+        QMutexLocker locker(&threadContextsMutex);
+        threadContexts.push_back(context);
+        result = context;
+    }
+    return result;
+}
+
+static std::vector<const QObject *> allThreadContexts()
+{
+    QMutexLocker locker(&threadContextsMutex);
+    return threadContexts;
+}
+
+PySideQSlotObject::PySideQSlotObject(PyObject *callback) :
+    QtPrivate::QSlotObjectBase(&PySideQSlotObject::impl),
+    m_key(GlobalReceiverV2::key(callback))
+{
+    if (PyMethod_Check(callback)) {
+        m_isMethod = true;
+        // Do not keep the instance alive, see DynamicSlotDataV2.
+        m_callback = PyMethod_GET_FUNCTION(callback);
+        Py_INCREF(m_callback);
+        m_pythonSelf = PyMethod_GET_SELF(callback);
+        m_weakRef = WeakRef::create(m_pythonSelf, PySideQSlotObject::onCallbackDestroyed, this);
+    } else if (PySide::isCompiledMethod(callback)) {
+        // PYSIDE-1523: PyMethod_Check is not accepting compiled form, we just go by attributes.
+        m_isMethod = true;
+        m_callback = PyObject_GetAttr(callback, PySide::PyName::im_func());
+        m_pythonSelf = PyObject_GetAttr(callback, PySide::PyName::im_self());
+        Py_DECREF(m_pythonSelf);
+        m_weakRef = WeakRef::create(m_pythonSelf, PySideQSlotObject::onCallbackDestroyed, this);
+    } else {
+        m_callback = callback;
+        Py_INCREF(m_callback);
+    }
+}
+
+PySideQSlotObject::~PySideQSlotObject()
+{
+    // Connections to long living objects may outlive the interpreter.
+    if (!Py_IsInitialized())
+        return;
+    Shiboken::GilState gil;
+    Py_XDECREF(m_weakRef);
+    Py_DECREF(m_callback);
+}
+
+PySideQSlotObject::ArgumentConverters
+    PySideQSlotObject::argumentConverters(const QMetaMethod &signal)
+{
+    const QByteArrayList argumentTypes = signal.parameterTypes();
+    ArgumentConverters result;
+    result.reserve(argumentTypes.size());
+    for (const auto &argumentType : argumentTypes)
+        result.emplace_back(argumentType.constData());
+    return result;
+}
+
+bool PySideQSlotObject::setArguments(const ArgumentConverters &signalConverters,
+                                     qsizetype argumentCount)
+{
+    m_isShortCircuit = argumentCount < 0;
+    if (m_isShortCircuit)
+        return true;
+    const auto size = std::min(size_t(argumentCount), signalConverters.size());
+    const auto end = signalConverters.cbegin() + size;
+    if (std::any_of(signalConverters.cbegin(), end, [](const auto &c) { return !c; }))
+        return false;
+    m_converters.assign(signalConverters.cbegin(), end);
+    return true;
+}
+
+void PySideQSlotObject::call(void **args)
+{
+    if (m_isMethod && m_pythonSelf == nullptr)
+        return; // The instance was deleted, the connection is about to go.
+
+    PyObject *callback = m_callback;
+    if (!m_isMethod) {
+        Py_INCREF(callback);
+    } else {
+        // Bind the function like PyMethod_Type does, also for compiled functions.
+        auto descrGet = Py_TYPE(m_callback)->tp_descr_get;
+        callback = descrGet != nullptr ? descrGet(m_callback, m_pythonSelf, nullptr)
+                                       : PyMethod_New(m_callback, m_pythonSelf);
+    }
+    if (callback == nullptr)
+        return;
+    Shiboken::AutoDecRef callbackGuard(callback);
+
+    if (m_isShortCircuit) {
+        Shiboken::AutoDecRef retval(PyObject_CallObject(callback,
+                                                        reinterpret_cast<PyObject *>(args[1])));
+        return;
+    }
+
+    const auto size = Py_ssize_t(m_converters.size());
+    Shiboken::AutoDecRef arguments(PyTuple_New(size));
+    for (Py_ssize_t i = 0; i < size; ++i)
+        PyTuple_SET_ITEM(arguments.object(), i, m_converters[i].toPython(args[i + 1]));
+    Shiboken::AutoDecRef retval(PyObject_CallObject(callback, arguments));
+}
+
+void PySideQSlotObject::impl(int which, QtPrivate::QSlotObjectBase *this_, QObject *,
+                             void **args, bool *ret)
+{
+    auto *self = static_cast<PySideQSlotObject *>(this_);
+    switch (which) {
+    case Destroy:
+        delete self;
+        break;
+    case Call: {
+        Shiboken::GilState gil;
+        self->call(args);
+        // Print errors so they are considered "handled", see GlobalReceiverV2::qt_metacall().
+        if (PyErr_Occurred()) {
+            const int reclimit = Py_GetRecursionLimit();
+            if (reclimit < (1 << 30))
+                Py_SetRecursionLimit(reclimit + 5);
+            PyErr_Print();
+            Py_SetRecursionLimit(reclimit);
+        }
+    }
+        break;
+    case Compare: {
+        auto *match = reinterpret_cast<PySideQSlotObjectMatch *>(args);
+        const bool result = !match->matched
+            && (match->slotObject != nullptr ? match->slotObject == self : match->key == self->m_key);
+        match->matched = match->matched || result;
+        *ret = result;
+    }
+        break;
+    case NumOperations:
+        break;
+    }
+}
+
+void PySideQSlotObject::onCallbackDestroyed(void *data)
+{
+    auto *self = reinterpret_cast<PySideQSlotObject *>(data);
+    self->m_weakRef = nullptr; // Released by the caller
+    self->m_pythonSelf = nullptr;
+    QObject *source = self->m_source.data();
+    if (source == nullptr)
+        return;
+    PySideQSlotObjectMatch match;
+    match.slotObject = self;
+    Py_BEGIN_ALLOW_THREADS
+    QObjectPrivate::disconnect(source, self->m_signalIndex, self->m_context,
+                               reinterpret_cast<void **>(&match));
+    Py_END_ALLOW_THREADS
+}
+
+QMetaObject::Connection PySideQSlotObject::connect(QObject *source, int signalIndex,
+                                                   const QObject *context, PyObject *callback,
+                                                   qsizetype argumentCount,
+                                                   Qt::ConnectionType type,
+                                                   const ArgumentConverters *signalConverters)
+{
+    auto *slotObject = new PySideQSlotObject(callback);
+    const bool ok = signalConverters != nullptr
+        ? slotObject->setArguments(*signalConverters, argumentCount)
+        : slotObject->setArguments(argumentConverters(source->metaObject()->method(signalIndex)),
+                                   argumentCount);
+    if (!ok) {
+        slotObject->destroyIfLastRef();
+        return {};
+    }
+    slotObject->m_source = source;
+    slotObject->m_context = context != nullptr ? context : currentThreadContext();
+    slotObject->m_signalIndex = signalIndex;
+    return QObjectPrivate::connect(source, signalIndex, slotObject->m_context,
+                                   slotObject, type);
+}
+
+bool PySideQSlotObject::disconnect(QObject *source, int signalIndex, const QObject *context,
+                                   PyObject *callback)
+{
+    PySideQSlotObjectMatch match;
+    match.key = GlobalReceiverV2::key(callback);
+    if (context != nullptr) {
+        return QObjectPrivate::disconnect(source, signalIndex, context,
+                                          reinterpret_cast<void **>(&match));
+    }
+    for (const QObject *threadContext : allThreadContexts()) {
+        if (QObjectPrivate::disconnect(source, signalIndex, threadContext,
+                                       reinterpret_cast<void **>(&match))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace PySide
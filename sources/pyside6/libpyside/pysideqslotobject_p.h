@@ -0,0 +1,89 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef PYSIDEQSLOTOBJECT_P_H
+#define PYSIDEQSLOTOBJECT_P_H
+
+#include <sbkpython.h>
+#include <sbkconverter.h>
+
+#include "globalreceiverv2.h"
+
+#include <QtCore/QMetaObject>
+#include <QtCore/QPointer>
+#include <QtCore/qobjectdefs_impl.h>
+
+#include <vector>
+
+QT_FORWARD_DECLARE_CLASS(QMetaMethod)
+
+namespace PySide
+{
+
+/// Argument passed as "slot" to QObjectPrivate::disconnect() to find the
+/// PySideQSlotObject of a callback. Only the first matching slot object is
+/// reported, which gives QObject::disconnect() "disconnect one" semantics.
+/// Note: Qt's QSlotObject also reads a member function pointer from it when
+/// comparing, the struct is large enough for that.
+struct PySideQSlotObjectMatch
+{
+    GlobalReceiverKey key{nullptr, nullptr};
+    const void *slotObject = nullptr; // If set, match this object only
+    bool matched = false;
+};
+
+/// A slot object connecting a signal to a Python callable without a receiver
+/// QObject, replacing the GlobalReceiverV2 with its dynamic meta object.
+/// It holds the callback and the converters of the signal arguments which
+/// are resolved when connecting.
+class PySideQSlotObject : public QtPrivate::QSlotObjectBase
+{
+public:
+    using ArgumentConverters = std::vector<Shiboken::Conversions::SpecificConverter>;
+
+    /// Return the converters of all arguments of \a signal, which are
+    /// invalid for types that cannot be converted.
+    static ArgumentConverters argumentConverters(const QMetaMethod &signal);
+
+    /// Connect \a signalIndex of \a source to \a callback, passing the first
+    /// \a argumentCount arguments (-1 for short circuit signals). The slot is
+    /// invoked in the thread of \a context or of the connecting thread if null.
+    /// \a signalConverters are the argumentConverters() of the signal if they
+    /// are known already, which is used when connecting many callbacks.
+    /// Returns an invalid connection if an argument type cannot be converted.
+    static QMetaObject::Connection connect(QObject *source, int signalIndex,
+                                           const QObject *context, PyObject *callback,
+                                           qsizetype argumentCount, Qt::ConnectionType type,
+                                           const ArgumentConverters *signalConverters = nullptr);
+
+    /// Disconnect one connection of \a signalIndex of \a source to \a callback
+    /// made with the same \a context.
+    static bool disconnect(QObject *source, int signalIndex, const QObject *context,
+                           PyObject *callback);
+
+private:
+    explicit PySideQSlotObject(PyObject *callback);
+    ~PySideQSlotObject();
+
+    static void impl(int which, QtPrivate::QSlotObjectBase *this_, QObject *receiver,
+                     void **args, bool *ret);
+    static void onCallbackDestroyed(void *data);
+
+    bool setArguments(const ArgumentConverters &signalConverters, qsizetype argumentCount);
+    void call(void **args);
+
+    PyObject *m_callback = nullptr;
+    PyObject *m_pythonSelf = nullptr;
+    PyObject *m_weakRef = nullptr;
+    GlobalReceiverKey m_key{nullptr, nullptr};
+    ArgumentConverters m_converters;
+    QPointer<QObject> m_source;
+    const QObject *m_context = nullptr;
+    int m_signalIndex = -1;
+    bool m_isMethod = false;
+    bool m_isShortCircuit = false;
+};
+
+} // namespace PySide
+
+#endif // PYSIDEQSLOTOBJECT_P_H
@@ -3,6 +3,7 @@
 
 #include "qobjectconnect.h"
 #include "pysideqobject.h"
+#include "pysideqslotobject_p.h"
 #include "pysidesignal.h"
 #include "pysideutils.h"
 #include "signalmanager.h"
@@ -12,9 +13,12 @@
 #include "autodecref.h"
 
 #include <QtCore/QDebug>
+#include <QtCore/QHash>
 #include <QtCore/QMetaMethod>
 #include <QtCore/QObject>
 
+#include <optional>
+
 static bool isMethodDecorator(PyObject *method, bool is_pymethod, PyObject *self)
 {
     Shiboken::AutoDecRef methodName(PyObject_GetAttr(method, Shiboken::PyMagicName::name()));
@@ -112,22 +116,87 @@ static GetReceiverResult getReceiver(QObject *source, const char *signal,
         }
     }
 
-    const auto receiverThread = result.receiver ? result.receiver->thread() : nullptr;
+    return result;
+}
 
-    if (result.usingGlobalReceiver) {
-        PySide::SignalManager &signalManager = PySide::SignalManager::instance();
-        result.receiver = signalManager.globalReceiver(source, callback);
-        // PYSIDE-1354: Move the global receiver to the original receivers's thread
-        // so that autoconnections work correctly.
-        if (receiverThread && receiverThread != result.receiver->thread())
-            result.receiver->moveToThread(receiverThread);
-        result.callbackSig =
-            PySide::Signal::getCallbackSignature(signal, result.receiver, callback,
-                                                 result.usingGlobalReceiver).toLatin1();
-        const QMetaObject *metaObject = result.receiver->metaObject();
-        result.slotIndex = metaObject->indexOfSlot(result.callbackSig.constData());
+// Replace the receiver by a GlobalReceiverV2 providing a dynamic slot for the callback.
+static void useGlobalReceiver(QObject *source, const char *signal, PyObject *callback,
+                              GetReceiverResult *result)
+{
+    const auto receiverThread = result->receiver ? result->receiver->thread() : nullptr;
+
+    PySide::SignalManager &signalManager = PySide::SignalManager::instance();
+    result->receiver = signalManager.globalReceiver(source, callback);
+    // PYSIDE-1354: Move the global receiver to the original receivers's thread
+    // so that autoconnections work correctly.
+    if (receiverThread && receiverThread != result->receiver->thread())
+        result->receiver->moveToThread(receiverThread);
+    result->callbackSig =
+        PySide::Signal::getCallbackSignature(signal, result->receiver, callback,
+                                             result->usingGlobalReceiver).toLatin1();
+    const QMetaObject *metaObject = result->receiver->metaObject();
+    result->slotIndex = metaObject->indexOfSlot(result->callbackSig.constData());
+}
+
+// Return the number of arguments of a signature returned by
+// PySide::Signal::getCallbackSignature(), -1 for short circuit signals.
+static qsizetype callbackArgumentCount(const QByteArray &signature)
+{
+    const auto open = signature.indexOf('(');
+    if (open == -1)
+        return -1;
+    if (signature.size() - open <= 2) // "()"
+        return 0;
+    qsizetype result = 1;
+    int depth = 0;
+    for (qsizetype i = open + 1, size = signature.size(); i < size; ++i) {
+        switch (signature.at(i)) {
+        case '<':
+            ++depth;
+            break;
+        case '>':
+            --depth;
+            break;
+        case ',':
+            if (depth == 0)
+                ++result;
+            break;
+        default:
+            break;
+        }
     }
+    return result;
+}
 
+// Data of a signal resolved once for all callbacks connected to it by
+// QObject.connectMany().
+struct BulkSignalData
+{
+    using FunctionKey = QPair<PyTypeObject *, PyObject *>; // Type of callback, function
+
+    std::optional<PySide::PySideQSlotObject::ArgumentConverters> converters;
+    QHash<FunctionKey, qsizetype> argumentCounts;
+};
+
+// Return the number of arguments passed to \a callback connected to
+// \a signal. With \a signalData, the count is determined once per function.
+static qsizetype callbackArgumentCount(const char *signal, QObject *receiver,
+                                       PyObject *callback, BulkSignalData *signalData)
+{
+    // The count of built-in functions depends on the meta object of the receiver.
+    const bool useCache = signalData != nullptr && !PyCFunction_Check(callback);
+    const BulkSignalData::FunctionKey key{Py_TYPE(callback), PyMethod_Check(callback)
+                                          ? PyMethod_GET_FUNCTION(callback) : callback};
+    if (useCache) {
+        const auto it = signalData->argumentCounts.constFind(key);
+        if (it != signalData->argumentCounts.cend())
+            return it.value();
+    }
+    const QByteArray callbackSig =
+        PySide::Signal::getCallbackSignature(signal, receiver, callback, false).toLatin1();
+    const qsizetype result = callbackArgumentCount(callbackSig);
+    if (useCache)
+        signalData->argumentCounts.insert(key, result);
     return result;
 }
 
@@ -164,20 +233,38 @@ QMetaObject::Connection qobjectConnect(QObject *source, QMetaMethod signal,
                           receiver, slot.methodSignature().constData(), type);
 }
 
-QMetaObject::Connection qobjectConnectCallback(QObject *source, const char *signal,
-                                               PyObject *callback, Qt::ConnectionType type)
+// Connect the registered signal \a signalIndex to a Python callback. When
+// connecting many callbacks, \a signalData holds what is resolved once per
+// signal.
+static QMetaObject::Connection connectCallback(QObject *source, int signalIndex,
+                                               const char *signal, PyObject *callback,
+                                               Qt::ConnectionType type,
+                                               BulkSignalData *signalData = nullptr)
 {
-    if (!signal || !PySide::Signal::checkQtSignal(signal))
-        return {};
-
-    const int signalIndex =
-        PySide::SignalManager::registerMetaMethodGetIndex(source, signal + 1,
-                                                          QMetaMethod::Signal);
-    if (signalIndex == -1)
-        return {};
-
     // Extract receiver from callback
-    const GetReceiverResult receiver = getReceiver(source, signal + 1, callback);
+    GetReceiverResult receiver = getReceiver(source, signal + 1, callback);
+    if (receiver.usingGlobalReceiver) {
+        // Connect callables without a receiver slot through a slot object unless
+        // Qt::UniqueConnection requires a slot index or an argument cannot be converted.
+        if ((type & Qt::UniqueConnection) == 0) {
+            const qsizetype argumentCount =
+                callbackArgumentCount(signal + 1, receiver.receiver, callback, signalData);
+            const PySideQSlotObject::ArgumentConverters *converters = nullptr;
+            if (signalData != nullptr) {
+                if (!signalData->converters.has_value()) {
+                    const QMetaMethod signalMethod = source->metaObject()->method(signalIndex);
+                    signalData->converters = PySideQSlotObject::argumentConverters(signalMethod);
+                }
+                converters = &signalData->converters.value();
+            }
+            auto connection =
+                PySideQSlotObject::connect(source, signalIndex, receiver.receiver, callback,
+                                           argumentCount, type, converters);
+            if (connection)
+                return connection;
+        }
+        useGlobalReceiver(source, signal + 1, callback, &receiver);
+    }
     if (receiver.receiver == nullptr && receiver.self == nullptr)
         return {};
 
@@ -224,17 +311,196 @@ QMetaObject::Connection qobjectConnectCallback(QObject *source, const char *sign
     return connection;
 }
 
+QMetaObject::Connection qobjectConnectCallback(QObject *source, const char *signal,
+                                               PyObject *callback, Qt::ConnectionType type)
+{
+    if (!signal || !PySide::Signal::checkQtSignal(signal))
+        return {};
+
+    const int signalIndex =
+        PySide::SignalManager::registerMetaMethodGetIndex(source, signal + 1,
+                                                          QMetaMethod::Signal);
+    if (signalIndex == -1)
+        return {};
+
+    return connectCallback(source, signalIndex, signal, callback, type);
+}
+
+// One item of QObject.connectMany()/disconnectMany(): either a callback
+// connection (sender, signal, callable) or (signal instance, callable), or a
+// string based connection (sender, signal, receiver, slot).
+struct BulkConnection
+{
+    QObject *source = nullptr;
+    QByteArray signal;
+    PyObject *callback = nullptr;
+    QObject *receiver = nullptr;
+    QByteArray slot;
+    int signalIndex = -1;
+};
+
+static bool bulkConnectionError(Py_ssize_t index, const char *message)
+{
+    PyErr_Format(PyExc_TypeError, "connection %zd: %s", index, message);
+    return false;
+}
+
+static bool parseSignalArgument(PyObject *pySignal, QByteArray *signal)
+{
+    if (!Shiboken::String::check(pySignal))
+        return false;
+    *signal = Shiboken::String::toCString(pySignal);
+    return PySide::Signal::checkQtSignal(signal->constData());
+}
+
+static bool parseBulkConnection(Py_ssize_t index, PyObject *item, BulkConnection *result)
+{
+    if (!PyTuple_Check(item))
+        return bulkConnectionError(index, "expected a tuple");
+
+    const Py_ssize_t size = PyTuple_GET_SIZE(item);
+    if (size < 2 || size > 4)
+        return bulkConnectionError(index, "expected a tuple of 2 to 4 items");
+
+    PyObject *first = PyTuple_GET_ITEM(item, 0);
+    switch (size) {
+    case 2: { // (signal instance, callable)
+        if (!PySide::Signal::checkInstanceType(first))
+            return bulkConnectionError(index, "expected a signal instance");
+        auto *signalInstance = reinterpret_cast<PySideSignalInstance *>(first);
+        result->source = convertToQObject(PySide::Signal::getObject(signalInstance), false);
+        result->signal = QByteArray(1, char('0' + QSIGNAL_CODE))
+                         + PySide::Signal::getSignature(signalInstance);
+        result->callback = PyTuple_GET_ITEM(item, 1);
+    }
+        break;
+    case 3: // (sender, signal, callable)
+        result->source = convertToQObject(first, false);
+        if (!parseSignalArgument(PyTuple_GET_ITEM(item, 1), &result->signal))
+            return bulkConnectionError(index, "expected a SIGNAL() string");
+        result->callback = PyTuple_GET_ITEM(item, 2);
+        break;
+    case 4: { // (sender, signal, receiver, slot)
+        result->source = convertToQObject(first, false);
+        if (!parseSignalArgument(PyTuple_GET_ITEM(item, 1), &result->signal))
+            return bulkConnectionError(index, "expected a SIGNAL() string");
+        result->receiver = convertToQObject(PyTuple_GET_ITEM(item, 2), false);
+        PyObject *slot = PyTuple_GET_ITEM(item, 3);
+        if (result->receiver == nullptr || !Shiboken::String::check(slot))
+            return bulkConnectionError(index, "expected a receiver QObject and a SLOT() string");
+        result->slot = Shiboken::String::toCString(slot);
+        // The code character is skipped when registering the slot.
+        const char code = result->slot.isEmpty() ? '\0' : result->slot.at(0);
+        if (result->slot.size() < 2
+            || (code != char('0' + QSLOT_CODE) && code != char('0' + QSIGNAL_CODE))) {
+            return bulkConnectionError(index, "expected a SLOT() or SIGNAL() string");
+        }
+    }
+        break;
+    default:
+        break;
+    }
+
+    if (result->source == nullptr)
+        return bulkConnectionError(index, "expected a sender QObject");
+    if (result->callback != nullptr && PyCallable_Check(result->callback) == 0)
+        return bulkConnectionError(index, "expected a callable");
+    return true;
+}
+
+static QList<BulkConnection> parseBulkConnections(PyObject *connections)
+{
+    QList<BulkConnection> result;
+    Shiboken::AutoDecRef sequence(PySequence_Fast(connections, "expected a sequence of tuples"));
+    if (sequence.isNull())
+        return result;
+    const Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence.object());
+    result.resize(size);
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject *item = PySequence_Fast_GET_ITEM(sequence.object(), i);
+        if (!parseBulkConnection(i, item, &result[i])) {
+            result.clear();
+            break;
+        }
+    }
+    return result;
+}
+
+QList<QMetaObject::Connection> qobjectConnectMany(PyObject *connections,
+                                                  Qt::ConnectionType type)
+{
+    QList<BulkConnection> items = parseBulkConnections(connections);
+    QList<QMetaObject::Connection> result;
+    if (items.isEmpty())
+        return result;
+
+    // Register all signals and slots before connecting anything. The meta
+    // object builders of the objects are then rebuilt once when the first
+    // connection queries them instead of after each registration.
+    for (auto &item : items) {
+        item.signalIndex =
+            PySide::SignalManager::registerMetaMethodGetIndex(item.source,
+                                                              item.signal.constData() + 1,
+                                                              QMetaMethod::Signal);
+        if (item.receiver != nullptr && item.signalIndex != -1) {
+            const auto methodType = PySide::Signal::isQtSignal(item.slot.constData())
+                                    ? QMetaMethod::Signal : QMetaMethod::Slot;
+            PySide::SignalManager::registerMetaMethod(item.receiver,
+                                                      item.slot.constData() + 1, methodType);
+        }
+    }
+
+    // The argument converters and callback argument counts depend on the
+    // signal signature only and are resolved once for all items using it.
+    QHash<QByteArray, BulkSignalData> signalData;
+    result.reserve(items.size());
+    for (const auto &item : std::as_const(items)) {
+        if (item.signalIndex == -1)
+            result.append({});
+        else if (item.receiver != nullptr)
+            result.append(QObject::connect(item.source, item.signal.constData(),
+                                           item.receiver, item.slot.constData(), type));
+        else
+            result.append(connectCallback(item.source, item.signalIndex,
+                                          item.signal.constData(), item.callback, type,
+                                          &signalData[item.signal]));
+    }
+    return result;
+}
+
+QList<bool> qobjectDisconnectMany(PyObject *connections)
+{
+    const QList<BulkConnection> items = parseBulkConnections(connections);
+    QList<bool> result;
+    result.reserve(items.size());
+    for (const auto &item : items) {
+        const bool disconnected = item.receiver != nullptr
+            ? QObject::disconnect(item.source, item.signal.constData(),
+                                  item.receiver, item.slot.constData())
+            : qobjectDisconnectCallback(item.source, item.signal.constData(), item.callback);
+        result.append(disconnected);
+    }
+    return result;
+}
+
 bool qobjectDisconnectCallback(QObject *source, const char *signal, PyObject *callback)
 {
     if (!PySide::Signal::checkQtSignal(signal))
         return false;
 
     // Extract receiver from callback
-    const GetReceiverResult receiver = getReceiver(nullptr, signal, callback);
+    GetReceiverResult receiver = getReceiver(nullptr, signal, callback);
+    const int signalIndex = source->metaObject()->indexOfSignal(signal + 1);
+    if (receiver.usingGlobalReceiver) {
+        if (signalIndex != -1
+            && PySideQSlotObject::disconnect(source, signalIndex, receiver.receiver, callback)) {
+            return true;
+        }
+        useGlobalReceiver(nullptr, signal, callback, &receiver);
+    }
     if (receiver.receiver == nullptr && receiver.self == nullptr)
         return false;
 
-    const int signalIndex = source->metaObject()->indexOfSignal(signal + 1);
     const int slotIndex = receiver.slotIndex;
 
     if (!QMetaObject::disconnectOne(source, signalIndex, receiver.receiver, slotIndex))
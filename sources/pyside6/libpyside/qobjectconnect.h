@@ -8,6 +8,7 @@
 
 #include <sbkpython.h>
 
+#include <QtCore/QList>
 #include <QtCore/QMetaObject>
 
 QT_FORWARD_DECLARE_CLASS(QObject)
@@ -37,6 +38,18 @@ PYSIDE_API QMetaObject::Connection
 PYSIDE_API bool qobjectDisconnectCallback(QObject *source, const char *signal,
                                           PyObject *callback);
 
+/// Helpers for QObject.connectMany(): Make the connections of a sequence of
+/// (sender, signal, callable), (signal instance, callable) or (sender, signal,
+/// receiver, slot) tuples. Returns an empty list and sets a Python error if
+/// the sequence is malformed, otherwise a connection for each item which is
+/// invalid if the item could not be connected.
+PYSIDE_API QList<QMetaObject::Connection>
+    qobjectConnectMany(PyObject *connections, Qt::ConnectionType type);
+
+/// Helpers for QObject.disconnectMany(): Disconnect a sequence of tuples as
+/// accepted by qobjectConnectMany(), returning the result for each item.
+PYSIDE_API QList<bool> qobjectDisconnectMany(PyObject *connections);
+
 } // namespace PySide
 
 #endif // QOBJECTCONNECT_H
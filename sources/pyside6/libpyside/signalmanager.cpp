@@ -21,6 +21,7 @@
 #include <sbkstaticstrings.h>
 #include <sbkerrors.h>
 
+#include <QtCore/QByteArrayList>
 #include <QtCore/QByteArrayView>
 #include <QtCore/QDebug>
 #include <QtCore/QHash>
@@ -29,6 +30,8 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <optional>
+#include <vector>
 
 #if QSLOT_CODE != 1 || QSIGNAL_CODE != 2
 #error QSLOT_CODE and/or QSIGNAL_CODE changed! change the hardcoded stuff to the correct value!
@@ -43,15 +46,114 @@ namespace {
     static PyObject *parseArguments(const QList< QByteArray >& paramTypes, void **args);
     static bool emitShortCircuitSignal(QObject *source, int signalIndex, PyObject *args);
 
+    // Instances of a Python class adding the same dynamic signals and slots
+    // in the same order share their meta objects. A builder used by one
+    // instance only is extended in place like an unshared one, keeping the
+    // meta objects it built already, and is not rebuilt before its meta
+    // object is requested. When its methods become the same as those of a
+    // builder of another instance, the instance switches to that one. Adding
+    // a method to a builder used by several instances copies it (copy on
+    // write). The meta objects are used without the GIL and may be referenced
+    // after the instance moved on, so a builder is reference counted by all
+    // instances which used it and retired when the last of them is destroyed.
+    struct SharedMetaObjectBuilder
+    {
+        PyTypeObject *type;
+        const QMetaObject *baseMetaObject;
+        size_t hash; // Of type, base meta object and the dynamic methods
+        QByteArrayList methods; // PYSIDE_SIGNAL/PYSIDE_SLOT + signature
+        std::unique_ptr<PySide::MetaObjectBuilder> builder;
+        int refCount = 1;
+        bool registered = false;
+    };
+
+    // Protected by the GIL
+    static QMultiHash<size_t, SharedMetaObjectBuilder *> sharedMetaObjectBuilders;
+
+    static void registerSharedMetaObjectBuilder(SharedMetaObjectBuilder *shared)
+    {
+        sharedMetaObjectBuilders.insert(shared->hash, shared);
+        shared->registered = true;
+    }
+
+    static void unregisterSharedMetaObjectBuilder(SharedMetaObjectBuilder *shared)
+    {
+        if (shared->registered) {
+            sharedMetaObjectBuilders.remove(shared->hash, shared);
+            shared->registered = false;
+        }
+    }
+
+    static void releaseSharedMetaObjectBuilder(SharedMetaObjectBuilder *shared)
+    {
+        if (--shared->refCount > 0)
+            return;
+        unregisterSharedMetaObjectBuilder(shared);
+        auto &bindingManager = Shiboken::BindingManager::instance();
+        if (SbkObject *wrapper = bindingManager.retrieveWrapper(shared->builder->update()))
+            bindingManager.releaseWrapper(wrapper);
+        delete shared;
+    }
+
+    // The dynamic meta object of an instance, kept in a capsule in its dict.
+    struct InstanceMetaObject
+    {
+        InstanceMetaObject(const InstanceMetaObject &) = delete;
+        InstanceMetaObject &operator=(const InstanceMetaObject &) = delete;
+
+        explicit InstanceMetaObject(const QMetaObject *b) : baseMetaObject(b) {}
+        ~InstanceMetaObject()
+        {
+            for (auto *shared : previous)
+                releaseSharedMetaObjectBuilder(shared);
+            if (current != nullptr)
+                releaseSharedMetaObjectBuilder(current);
+        }
+
+        // Switch to \a shared, keeping the reference to the previous builder.
+        void setCurrent(SharedMetaObjectBuilder *shared)
+        {
+            if (current != nullptr)
+                previous.push_back(current);
+            current = shared;
+        }
+
+        const QMetaObject *baseMetaObject;
+        SharedMetaObjectBuilder *current = nullptr;
+        std::vector<SharedMetaObjectBuilder *> previous;
+    };
+
     static void destroyMetaObject(PyObject *obj)
     {
         void *ptr = PyCapsule_GetPointer(obj, nullptr);
-        auto meta = reinterpret_cast<PySide::MetaObjectBuilder *>(ptr);
-        SbkObject *wrapper = Shiboken::BindingManager::instance().retrieveWrapper(meta);
-        if (wrapper)
-            Shiboken::BindingManager::instance().releaseWrapper(wrapper);
-        delete meta;
+        delete reinterpret_cast<InstanceMetaObject *>(ptr);
     }
+
+    // The data needed to invoke a Python slot of a dynamic meta object,
+    // determined on the first invocation by qtMethodMetacall().
+    struct PythonSlotRecord
+    {
+        PythonSlotRecord(const PythonSlotRecord &) = delete;
+        PythonSlotRecord &operator=(const PythonSlotRecord &) = delete;
+
+        PythonSlotRecord() = default;
+        ~PythonSlotRecord()
+        {
+            if (Py_IsInitialized())
+                Py_XDECREF(name);
+        }
+
+        PyObject *name = nullptr; // Interned method name
+        std::vector<Shiboken::Conversions::SpecificConverter> argumentConverters;
+        std::optional<Shiboken::Conversions::SpecificConverter> returnConverter;
+        QByteArray missingArgumentType; // Set if there is no converter
+        QByteArray missingReturnType;
+    };
+
+    using PythonSlotRecordKey = std::pair<const QMetaObject *, int>;
+
+    // Keyed by meta object and method index. Protected by the GIL.
+    static QHash<PythonSlotRecordKey, PythonSlotRecord *> pythonSlotRecords;
 }
 
 static const char *metaCallName(QMetaObject::Call call)
@@ -265,6 +367,7 @@ SignalManager::SignalManager() : m_d(new SignalManagerPrivate)
 
 void SignalManager::clear()
 {
+    clearSlotCallCache();
     delete m_d;
     m_d = new SignalManagerPrivate();
 }
@@ -427,6 +530,118 @@ int SignalManager::SignalManagerPrivate::qtPropertyMetacall(QObject *object,
     return result;
 }
 
+namespace PySide {
+
+void clearSlotCallCache()
+{
+    qDeleteAll(pythonSlotRecords);
+    pythonSlotRecords.clear();
+}
+
+void clearSlotCallCache(const QMetaObject *metaObject)
+{
+    if (pythonSlotRecords.isEmpty())
+        return;
+    // The records are keyed by the meta object of the receiver, which
+    // includes the methods of its base classes.
+    for (int i = 0, count = metaObject->methodCount(); i < count; ++i)
+        delete pythonSlotRecords.take({metaObject, i});
+}
+
+} // namespace PySide
+
+static PythonSlotRecord *createPythonSlotRecord(const QMetaMethod &method)
+{
+    auto *record = new PythonSlotRecord;
+    QByteArray methodName = method.methodSignature();
+    methodName.truncate(methodName.indexOf('('));
+    record->name = PyUnicode_InternFromString(methodName.constData());
+
+    const QByteArrayList parameterTypes = method.parameterTypes();
+    record->argumentConverters.reserve(parameterTypes.size());
+    for (const auto &parameterType : parameterTypes) {
+        Shiboken::Conversions::SpecificConverter converter(parameterType.constData());
+        if (!converter) {
+            record->missingArgumentType = parameterType;
+            break;
+        }
+        record->argumentConverters.push_back(converter);
+    }
+
+    const char *returnType = method.typeName();
+    if (returnType && std::strcmp("", returnType) && std::strcmp("void", returnType)) {
+        Shiboken::Conversions::SpecificConverter converter(returnType);
+        if (converter)
+            record->returnConverter = converter;
+        else
+            record->missingReturnType = returnType;
+    }
+    return record;
+}
+
+static PythonSlotRecord *pythonSlotRecord(const QMetaObject *metaObject, int id,
+                                          const QMetaMethod &method)
+{
+    const PythonSlotRecordKey key{metaObject, id};
+    auto it = pythonSlotRecords.constFind(key);
+    if (it != pythonSlotRecords.cend())
+        return it.value();
+    auto *record = createPythonSlotRecord(method);
+    pythonSlotRecords.insert(key, record);
+    return record;
+}
+
+// Call the slot of \a pySelf described by \a record. The function found in
+// the type is called with self prepended to the arguments, which avoids
+// creating a bound method, unless an instance attribute shadows it.
+// Returns false if the slot does not exist.
+static bool callPythonSlot(PythonSlotRecord *record, PyObject *pySelf, void **args)
+{
+
+    PyObject *function = _PepType_Lookup(Py_TYPE(pySelf), record->name);
+    const bool callFunction = function != nullptr && PyFunction_Check(function)
+        && PyDict_GetItem(SbkObject_GetDict_NoRef(pySelf), record->name) == nullptr;
+    PyObject *callable = callFunction
+        ? function : PyObject_GetAttr(pySelf, record->name);
+    if (callable == nullptr)
+        return false;
+    if (callFunction)
+        Py_INCREF(callable);
+    Shiboken::AutoDecRef callableGuard(callable);
+
+    if (!record->missingArgumentType.isEmpty()) {
+        PyErr_Format(PyExc_TypeError,
+                     "Can't call meta function because I have no idea how to handle %s",
+                     record->missingArgumentType.constData());
+        return true;
+    }
+    if (!record->missingReturnType.isEmpty()) {
+        PyErr_Format(PyExc_RuntimeError,
+                     "Can't find converter for '%s' to call Python meta method.",
+                     record->missingReturnType.constData());
+        return true;
+    }
+
+    const Py_ssize_t offset = callFunction ? 1 : 0;
+    const auto argumentCount = Py_ssize_t(record->argumentConverters.size());
+    Shiboken::AutoDecRef arguments(PyTuple_New(argumentCount + offset));
+    if (callFunction) {
+        Py_INCREF(pySelf);
+        PyTuple_SET_ITEM(arguments.object(), 0, pySelf);
+    }
+    for (Py_ssize_t i = 0; i < argumentCount; ++i) {
+        PyTuple_SET_ITEM(arguments.object(), i + offset,
+                         record->argumentConverters[i].toPython(args[i + 1]));
+    }
+
+    // The slot may free meta objects and thus the record.
+    auto returnConverter = record->returnConverter;
+    Shiboken::AutoDecRef retval(PyObject_Call(callable, arguments, nullptr));
+    if (!retval.isNull() && retval != Py_None && !PyErr_Occurred() && returnConverter)
+        returnConverter->toCpp(retval, args[0]);
+    return true;
+}
+
 // Handler for QMetaObject::InvokeMetaMethod
 int SignalManager::SignalManagerPrivate::qtMethodMetacall(QObject *object,
                                                           int id, void **args)
@@ -448,14 +663,11 @@ int SignalManager::SignalManagerPrivate::qtMethodMetacall(QObject *object,
         auto *pySbkSelf = Shiboken::BindingManager::instance().retrieveWrapper(object);
         Q_ASSERT(pySbkSelf);
         auto *pySelf = reinterpret_cast<PyObject *>(pySbkSelf);
-        QByteArray methodName = method.methodSignature();
-        methodName.truncate(methodName.indexOf('('));
-        Shiboken::AutoDecRef pyMethod(PyObject_GetAttrString(pySelf, methodName));
-        if (pyMethod.isNull()) {
+        auto *record = pythonSlotRecord(metaObject, id, method);
+        if (!callPythonSlot(record, pySelf, args)) {
+            PyErr_Clear();
             PyErr_Format(PyExc_AttributeError, "Slot '%s::%s' not found.",
                          metaObject->className(), method.methodSignature().constData());
-        } else {
-            SignalManager::callPythonMetaMethod(method, args, pyMethod, false);
         }
     }
     // WARNING Isn't safe to call any metaObject and/or object methods beyond this point
@@ -541,7 +753,7 @@ bool SignalManager::registerMetaMethod(QObject *source, const char *signature, Q
     return (ret != -1);
 }
 
-static MetaObjectBuilder *metaBuilderFromDict(PyObject *dict)
+static InstanceMetaObject *instanceMetaObjectFromDict(PyObject *dict)
 {
     // PYSIDE-803: The dict in this function is the ob_dict of an SbkObject.
     // The "metaObjectAttr" entry is only handled in this file. There is no
@@ -556,7 +768,94 @@ static MetaObjectBuilder *metaBuilderFromDict(PyObject *dict)
     // PyDict_GetItem would touch PyThreadState_GET and the global error state.
     // PyDict_GetItemWithError instead can work without GIL.
     PyObject *pyBuilder = PyDict_GetItemWithError(dict, metaObjectAttr);
-    return reinterpret_cast<MetaObjectBuilder *>(PyCapsule_GetPointer(pyBuilder, nullptr));
+    return reinterpret_cast<InstanceMetaObject *>(PyCapsule_GetPointer(pyBuilder, nullptr));
+}
+
+static MetaObjectBuilder *metaBuilderFromDict(PyObject *dict)
+{
+    InstanceMetaObject *instanceMetaObject = instanceMetaObjectFromDict(dict);
+    return instanceMetaObject != nullptr && instanceMetaObject->current != nullptr
+        ? instanceMetaObject->current->builder.get() : nullptr;
+}
+
+// Find a registered builder of \a type and \a baseMetaObject with the
+// methods of \a current (if any) followed by \a method.
+static SharedMetaObjectBuilder *
+    findSharedMetaObjectBuilder(PyTypeObject *type, const QMetaObject *baseMetaObject,
+                                size_t hash, const SharedMetaObjectBuilder *current,
+                                const QByteArray &method)
+{
+    const qsizetype size = current != nullptr ? current->methods.size() : 0;
+    const auto range = sharedMetaObjectBuilders.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        auto *shared = it.value();
+        if (shared != current && shared->type == type
+            && shared->baseMetaObject == baseMetaObject
+            && shared->methods.size() == size + 1 && shared->methods.constLast() == method
+            && (current == nullptr
+                || std::equal(current->methods.cbegin(), current->methods.cend(),
+                              shared->methods.cbegin()))) {
+            return shared;
+        }
+    }
+    return nullptr;
+}
+
+static int addBuilderMethod(MetaObjectBuilder *builder, const QByteArray &method)
+{
+    const char *signature = method.constData() + 1;
+    return method.at(0) == PYSIDE_SIGNAL
+        ? builder->addSignal(signature) : builder->addSlot(signature);
+}
+
+// Add a dynamic signal or slot to an instance. The meta object is not
+// built here; as for unshared builders, it is built once when requested,
+// which keeps registering many methods (QObject.connectMany()) linear.
+static int addInstanceMethod(PyObject *pySelf, InstanceMetaObject *instanceMetaObject,
+                             const char *signature, QMetaMethod::MethodType type)
+{
+    auto *pyType = Py_TYPE(pySelf);
+    const QMetaObject *baseMetaObject = instanceMetaObject->baseMetaObject;
+    SharedMetaObjectBuilder *current = instanceMetaObject->current;
+    const QByteArray method =
+        QByteArray(1, type == QMetaMethod::Signal ? PYSIDE_SIGNAL : PYSIDE_SLOT) + signature;
+    const size_t hash = current != nullptr
+        ? qHashMulti(current->hash, method)
+        : qHashMulti(0, quintptr(pyType), quintptr(baseMetaObject), method);
+
+    if (auto *shared = findSharedMetaObjectBuilder(pyType, baseMetaObject, hash, current, method)) {
+        ++shared->refCount;
+        instanceMetaObject->setCurrent(shared);
+        return shared->builder->indexOfMethod(type, signature);
+    }
+
+    if (current != nullptr && current->refCount == 1) { // Used by this instance only
+        const int index = addBuilderMethod(current->builder.get(), method);
+        if (index != -1) {
+            unregisterSharedMetaObjectBuilder(current);
+            current->hash = hash;
+            current->methods.append(method);
+            registerSharedMetaObjectBuilder(current);
+        }
+        return index;
+    }
+
+    auto builder = std::make_unique<MetaObjectBuilder>(pyType, baseMetaObject);
+    QByteArrayList methods;
+    if (current != nullptr) {
+        methods = current->methods;
+        for (const auto &m : std::as_const(methods))
+            addBuilderMethod(builder.get(), m);
+    }
+    const int index = addBuilderMethod(builder.get(), method);
+    if (index == -1)
+        return -1;
+    methods.append(method);
+    auto *shared = new SharedMetaObjectBuilder{pyType, baseMetaObject, hash, methods,
+                                               std::move(builder)};
+    registerSharedMetaObjectBuilder(shared);
+    instanceMetaObject->setCurrent(shared);
+    return index;
 }
 
 // Helper to format a method signature "foo(QString)" into
@@ -617,23 +916,31 @@ int SignalManager::registerMetaMethodGetIndex(QObject *source, const char *signa
                  signature);
         return -1;
     }
-    const QMetaObject *metaObject = source->metaObject();
-    int methodIndex = metaObject->indexOfMethod(signature);
+    SbkObject *self = Shiboken::BindingManager::instance().retrieveWrapper(source);
+    auto *pySelf = reinterpret_cast<PyObject *>(self);
+    // Look up methods in the instance meta object builder when there is one.
+    // source->metaObject() would rebuild the meta object after each added
+    // method, which makes registering many methods (QObject.connectMany())
+    // quadratic.
+    InstanceMetaObject *instanceMetaObject =
+        self != nullptr && Shiboken::Object::hasCppWrapper(self)
+        ? instanceMetaObjectFromDict(SbkObject_GetDict_NoRef(pySelf)) : nullptr;
+    MetaObjectBuilder *dmo = instanceMetaObject != nullptr && instanceMetaObject->current != nullptr
+        ? instanceMetaObject->current->builder.get() : nullptr;
+    int methodIndex = dmo != nullptr
+        ? dmo->indexOfMethod(QMetaMethod::Method, signature)
+        : source->metaObject()->indexOfMethod(signature);
     // Create the dynamic signal is needed
     if (methodIndex == -1) {
-        SbkObject *self = Shiboken::BindingManager::instance().retrieveWrapper(source);
-        if (!Shiboken::Object::hasCppWrapper(self)) {
+        if (self == nullptr || !Shiboken::Object::hasCppWrapper(self)) {
             qWarning() << "Invalid Signal signature:" << signature;
             return -1;
         }
-        auto *pySelf = reinterpret_cast<PyObject *>(self);
-        auto *dict = SbkObject_GetDict_NoRef(pySelf);
-        MetaObjectBuilder *dmo = metaBuilderFromDict(dict);
 
         // Create a instance meta object
-        if (!dmo) {
-            dmo = new MetaObjectBuilder(Py_TYPE(pySelf), metaObject);
-            PyObject *pyDmo = PyCapsule_New(dmo, nullptr, destroyMetaObject);
+        if (!instanceMetaObject) {
+            instanceMetaObject = new InstanceMetaObject(source->metaObject());
+            PyObject *pyDmo = PyCapsule_New(instanceMetaObject, nullptr, destroyMetaObject);
             PyObject_SetAttr(pySelf, metaObjectAttr, pyDmo);
             Py_DECREF(pyDmo);
         }
@@ -645,8 +952,7 @@ int SignalManager::registerMetaMethodGetIndex(QObject *source, const char *signa
                 << ". Consider annotating with " << slotSignature(signature);
         }
 
-        return type == QMetaMethod::Signal
-            ? dmo->addSignal(signature) : dmo->addSlot(signature);
+        return addInstanceMethod(pySelf, instanceMetaObject, signature, type);
     }
     return methodIndex;
 }
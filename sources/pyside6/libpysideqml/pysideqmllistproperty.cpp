@@ -10,6 +10,8 @@
 #include <pysideproperty.h>
 #include <pysideproperty_p.h>
 
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
 #include <QtCore/QObject>
 #include <QtQml/QQmlListProperty>
 
@@ -17,8 +19,12 @@
 class QmlListPropertyPrivate : public PySidePropertyPrivate
 {
 public:
+    ~QmlListPropertyPrivate() override;
+
     void metaCall(PyObject *source, QMetaObject::Call call, void **args) override;
 
+    PyObject *nativeView(QObject *object);
+
     PyTypeObject *type = nullptr;
     PyObject *append = nullptr;
     PyObject *count = nullptr;
@@ -26,11 +32,241 @@ public:
     PyObject *clear = nullptr;
     PyObject *replace = nullptr;
     PyObject *removeLast = nullptr;
+    bool native = false;
+
+private:
+    struct NativeViewEntry
+    {
+        PyObject *view;
+        QMetaObject::Connection destroyedConnection;
+    };
+
+    // Native storage per QObject instance ("native=True")
+    QHash<const QObject *, NativeViewEntry> m_nativeViews;
+};
+
+// Native storage of a ListProperty declared with "native=True". The items
+// are held in a QObjectList which QML accesses via count/at without
+// acquiring the GIL. The Python wrappers of the items are kept in a parallel
+// list which keeps them alive and is returned on item access.
+// The QObjectList is only modified with the GIL held and itemsMutex locked.
+// count/at, which run without the GIL, lock itemsMutex; code holding the
+// GIL may read the list without locking.
+struct QmlListPropertyView
+{
+    PyObject_HEAD
+    QObjectList *items;
+    QMutex *itemsMutex;
+    PyObject *pyItems;
+    PyTypeObject *type;
 };
 
 extern "C"
 {
 
+static int listViewCheckIndex(QmlListPropertyView *view, Py_ssize_t index)
+{
+    if (index < 0 || index >= view->items->size()) {
+        PyErr_SetString(PyExc_IndexError, "ListProperty index out of range");
+        return -1;
+    }
+    return 0;
+}
+
+static QObject *listViewToCpp(QmlListPropertyView *view, PyObject *item)
+{
+    if (!PyObject_TypeCheck(item, view->type)) {
+        PyErr_Format(PyExc_TypeError, "An instance of %s expected, got %s.",
+                     view->type->tp_name, Py_TYPE(item)->tp_name);
+        return nullptr;
+    }
+    QObject *result = nullptr;
+    Shiboken::Conversions::pythonToCppPointer(qObjectType(), item, &result);
+    return result;
+}
+
+static int listView_tp_traverse(PyObject *self, visitproc visit, void *arg)
+{
+    auto *view = reinterpret_cast<QmlListPropertyView *>(self);
+    Py_VISIT(view->pyItems);
+    Py_VISIT(reinterpret_cast<PyObject *>(view->type));
+    return 0;
+}
+
+// Breaks cycles through the item wrappers. The item type is kept since
+// the methods still check against it.
+static int listView_tp_clear(PyObject *self)
+{
+    auto *view = reinterpret_cast<QmlListPropertyView *>(self);
+    if (view->items != nullptr) {
+        QMutexLocker locker(view->itemsMutex);
+        view->items->clear();
+    }
+    Py_CLEAR(view->pyItems);
+    return 0;
+}
+
+static void listView_tp_dealloc(PyObject *self)
+{
+    auto *view = reinterpret_cast<QmlListPropertyView *>(self);
+    PyObject_GC_UnTrack(self);
+    listView_tp_clear(self);
+    delete view->items;
+    delete view->itemsMutex;
+    Py_XDECREF(reinterpret_cast<PyObject *>(view->type));
+    PyTypeObject *type = Py_TYPE(self);
+    type->tp_free(self);
+    if (PepRuntime_38_flag) {
+        // PYSIDE-939: Handling references correctly.
+        Py_DECREF(type);
+    }
+}
+
+static Py_ssize_t listView_sq_length(PyObject *self)
+{
+    return reinterpret_cast<QmlListPropertyView *>(self)->items->size();
+}
+
+static PyObject *listView_sq_item(PyObject *self, Py_ssize_t index)
+{
+    auto *view = reinterpret_cast<QmlListPropertyView *>(self);
+    if (listViewCheckIndex(view, index) < 0)
+        return nullptr;
+    PyObject *result = PyList_GetItem(view->pyItems, index);
+    Py_XINCREF(result);
+    return result;
+}
+
+static int listView_sq_ass_item(PyObject *self, Py_ssize_t index, PyObject *value)
+{
+    auto *view = reinterpret_cast<QmlListPropertyView *>(self);
+    if (value == nullptr) {
+        PyErr_SetString(PyExc_TypeError, "ListProperty items cannot be deleted by index, "
+                                         "use removeLast() or clear().");
+        return -1;
+    }
+    if (listViewCheckIndex(view, index) < 0)
+        return -1;
+    QObject *cppValue = listViewToCpp(view, value);
+    if (cppValue == nullptr)
+        return -1;
+    Py_INCREF(value);
+    if (PyList_SetItem(view->pyItems, index, value) < 0) // steals
+        return -1;
+    QMutexLocker locker(view->itemsMutex);
+    view->items->replace(index, cppValue);
+    return 0;
+}
+
+static PyObject *listView_append(PyObject *self, PyObject *item)
+{
+    auto *view = reinterpret_cast<QmlListPropertyView *>(self);
+    QObject *cppItem = listViewToCpp(view, item);
+    if (cppItem == nullptr || PyList_Append(view->pyItems, item) < 0)
+        return nullptr;
+    QMutexLocker locker(view->itemsMutex);
+    view->items->append(cppItem);
+    Py_RETURN_NONE;
+}
+
+static PyObject *listView_clear(PyObject *self, PyObject * /* args */)
+{
+    auto *view = reinterpret_cast<QmlListPropertyView *>(self);
+    {
+        QMutexLocker locker(view->itemsMutex);
+        view->items->clear();
+    }
+    if (PyList_SetSlice(view->pyItems, 0, PyList_Size(view->pyItems), nullptr) < 0)
+        return nullptr;
+    Py_RETURN_NONE;
+}
+
+static PyObject *listView_removeLast(PyObject *self, PyObject * /* args */)
+{
+    auto *view = reinterpret_cast<QmlListPropertyView *>(self);
+    const Py_ssize_t size = view->items->size();
+    if (size == 0) {
+        PyErr_SetString(PyExc_IndexError, "removeLast() called on an empty ListProperty");
+        return nullptr;
+    }
+    {
+        QMutexLocker locker(view->itemsMutex);
+        view->items->removeLast();
+    }
+    if (PyList_SetSlice(view->pyItems, size - 1, size, nullptr) < 0)
+        return nullptr;
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef ListPropertyView_methods[] = {
+    {"append", reinterpret_cast<PyCFunction>(listView_append), METH_O, nullptr},
+    {"clear", reinterpret_cast<PyCFunction>(listView_clear), METH_NOARGS, nullptr},
+    {"removeLast", reinterpret_cast<PyCFunction>(listView_removeLast), METH_NOARGS, nullptr},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+static PyType_Slot ListPropertyView_slots[] = {
+    {Py_tp_dealloc, reinterpret_cast<void *>(listView_tp_dealloc)},
+    {Py_tp_traverse, reinterpret_cast<void *>(listView_tp_traverse)},
+    {Py_tp_clear, reinterpret_cast<void *>(listView_tp_clear)},
+    {Py_sq_length, reinterpret_cast<void *>(listView_sq_length)},
+    {Py_sq_item, reinterpret_cast<void *>(listView_sq_item)},
+    {Py_sq_ass_item, reinterpret_cast<void *>(listView_sq_ass_item)},
+    {Py_tp_methods, reinterpret_cast<void *>(ListPropertyView_methods)},
+    {0, nullptr}
+};
+static PyType_Spec ListPropertyView_spec = {
+    "2:PySide6.QtQml.ListPropertyView",
+    sizeof(QmlListPropertyView),
+    0,
+    Py_TPFLAGS_DEFAULT|Py_TPFLAGS_HAVE_GC,
+    ListPropertyView_slots,
+};
+
+static PyTypeObject *ListPropertyView_TypeF()
+{
+    static auto *type = SbkType_FromSpec(&ListPropertyView_spec);
+    return type;
+}
+
+static PyObject *listView_new(PyTypeObject *itemType)
+{
+    PyTypeObject *viewType = ListPropertyView_TypeF();
+    // tp_alloc zero-initializes the view and tracks it by the GC.
+    auto *view = reinterpret_cast<QmlListPropertyView *>(viewType->tp_alloc(viewType, 0));
+    if (view == nullptr)
+        return nullptr;
+    view->pyItems = PyList_New(0);
+    if (view->pyItems == nullptr) {
+        Py_DECREF(reinterpret_cast<PyObject *>(view));
+        return nullptr;
+    }
+    view->items = new QObjectList;
+    view->itemsMutex = new QMutex;
+    view->type = itemType;
+    Py_INCREF(reinterpret_cast<PyObject *>(itemType));
+    return reinterpret_cast<PyObject *>(view);
+}
+
+// Getter installed as "fget" of a native ListProperty: Returns the view.
+static PyObject *propListNativeGetter(PyObject *self, PyObject *source)
+{
+    auto *data = static_cast<QmlListPropertyPrivate *>(reinterpret_cast<PySideProperty *>(self)->d);
+    QObject *qobj = nullptr;
+    Shiboken::Conversions::pythonToCppPointer(qObjectType(), source, &qobj);
+    if (qobj == nullptr) {
+        PyErr_SetString(PyExc_TypeError, "ListProperty requires a QObject instance.");
+        return nullptr;
+    }
+    PyObject *result = data->nativeView(qobj);
+    Py_XINCREF(result);
+    return result;
+}
+
+static PyMethodDef propListNativeGetterDef = {
+    "_listPropertyView", reinterpret_cast<PyCFunction>(propListNativeGetter), METH_O, nullptr
+};
+
 static PyObject *propList_tp_new(PyTypeObject *subtype, PyObject * /* args */, PyObject * /* kwds */)
 {
     PySideProperty *me = reinterpret_cast<PySideProperty *>(subtype->tp_alloc(subtype, 0));
@@ -40,20 +276,23 @@ static PyObject *propList_tp_new(PyTypeObject *subtype, PyObject * /* args */, P
 
 static int propListTpInit(PyObject *self, PyObject *args, PyObject *kwds)
 {
-    static const char *kwlist[] = {"type", "append", "count", "at", "clear", "replace", "removeLast", 0};
+    static const char *kwlist[] = {"type", "append", "count", "at", "clear", "replace", "removeLast",
+                                   "native", 0};
     PySideProperty *pySelf = reinterpret_cast<PySideProperty *>(self);
 
     auto *data = static_cast<QmlListPropertyPrivate *>(pySelf->d);
+    int native = 0;
 
     if (!PyArg_ParseTupleAndKeywords(args, kwds,
-                                     "O|OOOOOO:QtQml.ListProperty", (char **) kwlist,
+                                     "O|OOOOOO$p:QtQml.ListProperty", (char **) kwlist,
                                      &data->type,
                                      &data->append,
                                      &data->count,
                                      &data->at,
                                      &data->clear,
                                      &data->replace,
-                                     &data->removeLast)) {
+                                     &data->removeLast,
+                                     &native)) {
         return -1;
     }
 
@@ -75,6 +314,21 @@ static int propListTpInit(PyObject *self, PyObject *args, PyObject *kwds)
         return -1;
     }
 
+    if (native != 0) {
+        auto isSet = [](PyObject *o) { return o != nullptr && o != Py_None; };
+        if (isSet(data->append) || isSet(data->count) || isSet(data->at)
+            || isSet(data->clear) || isSet(data->replace) || isSet(data->removeLast)) {
+            PyErr_SetString(PyExc_TypeError,
+                            "A native ListProperty cannot have accessor functions.");
+            return -1;
+        }
+        data->native = true;
+        Py_XDECREF(data->fget);
+        data->fget = PyCFunction_New(&propListNativeGetterDef, self);
+        if (data->fget == nullptr)
+            return -1;
+    }
+
     data->typeName = QByteArrayLiteral("QQmlListProperty<QObject>");
 
     return 0;
@@ -227,6 +481,102 @@ void propListRemoveLast(QQmlListProperty<QObject> *propList)
         PyErr_Print();
 }
 
+// Native ListProperty callbacks: count and at operate on the QObjectList
+// only and lock itemsMutex instead of acquiring the GIL.
+static qsizetype nativePropListCount(QQmlListProperty<QObject> *propList)
+{
+    auto *view = reinterpret_cast<QmlListPropertyView *>(propList->data);
+    QMutexLocker locker(view->itemsMutex);
+    return view->items->size();
+}
+
+static QObject *nativePropListAt(QQmlListProperty<QObject> *propList, qsizetype index)
+{
+    auto *view = reinterpret_cast<QmlListPropertyView *>(propList->data);
+    QMutexLocker locker(view->itemsMutex);
+    return view->items->value(index);
+}
+
+// Modifying callbacks keep the Python wrapper list in sync.
+static void nativePropListAppender(QQmlListProperty<QObject> *propList, QObject *item)
+{
+    Shiboken::GilState state;
+    auto *view = reinterpret_cast<QmlListPropertyView *>(propList->data);
+    Shiboken::AutoDecRef pyItem(Shiboken::Conversions::pointerToPython(qObjectType(), item));
+    if (PyList_Append(view->pyItems, pyItem) < 0) {
+        PyErr_Print();
+        return;
+    }
+    QMutexLocker locker(view->itemsMutex);
+    view->items->append(item);
+}
+
+static void nativePropListClear(QQmlListProperty<QObject> *propList)
+{
+    Shiboken::GilState state;
+    Shiboken::AutoDecRef result(listView_clear(reinterpret_cast<PyObject *>(propList->data),
+                                               nullptr));
+    if (result.isNull())
+        PyErr_Print();
+}
+
+static void nativePropListReplace(QQmlListProperty<QObject> *propList, qsizetype index,
+                                  QObject *value)
+{
+    Shiboken::GilState state;
+    auto *view = reinterpret_cast<QmlListPropertyView *>(propList->data);
+    if (index < 0 || index >= view->items->size())
+        return;
+    PyObject *pyValue = Shiboken::Conversions::pointerToPython(qObjectType(), value);
+    if (PyList_SetItem(view->pyItems, index, pyValue) < 0) { // steals
+        PyErr_Print();
+        return;
+    }
+    QMutexLocker locker(view->itemsMutex);
+    view->items->replace(index, value);
+}
+
+static void nativePropListRemoveLast(QQmlListProperty<QObject> *propList)
+{
+    Shiboken::GilState state;
+    Shiboken::AutoDecRef result(listView_removeLast(reinterpret_cast<PyObject *>(propList->data),
+                                                    nullptr));
+    if (result.isNull())
+        PyErr_Print();
+}
+
+QmlListPropertyPrivate::~QmlListPropertyPrivate()
+{
+    for (const auto &entry : qAsConst(m_nativeViews)) {
+        QObject::disconnect(entry.destroyedConnection);
+        Py_DECREF(entry.view);
+    }
+}
+
+// Return the view holding the native storage for an instance (borrowed reference).
+PyObject *QmlListPropertyPrivate::nativeView(QObject *object)
+{
+    auto it = m_nativeViews.find(object);
+    if (it != m_nativeViews.end())
+        return it.value().view;
+
+    PyObject *view = listView_new(type);
+    if (view == nullptr)
+        return nullptr;
+    auto onDestroyed = [this, object]() {
+        Shiboken::GilState state;
+        auto it = m_nativeViews.find(object);
+        if (it != m_nativeViews.end()) {
+            PyObject *view = it.value().view;
+            m_nativeViews.erase(it);
+            Py_DECREF(view);
+        }
+    };
+    auto connection = QObject::connect(object, &QObject::destroyed, onDestroyed);
+    m_nativeViews.insert(object, {view, connection});
+    return view;
+}
+
 // qt_metacall specialization for ListProperties
 void QmlListPropertyPrivate::metaCall(PyObject *source, QMetaObject::Call call, void **args)
 {
@@ -236,6 +586,22 @@ void QmlListPropertyPrivate::metaCall(PyObject *source, QMetaObject::Call call,
     QObject *qobj;
     PyTypeObject *qobjectType = qObjectType();
     Shiboken::Conversions::pythonToCppPointer(qobjectType, source, &qobj);
+
+    if (native) {
+        PyObject *view = nativeView(qobj);
+        if (view == nullptr)
+            return;
+        QQmlListProperty<QObject> nativeProp(qobj, view,
+                                             &nativePropListAppender,
+                                             &nativePropListCount,
+                                             &nativePropListAt,
+                                             &nativePropListClear,
+                                             &nativePropListReplace,
+                                             &nativePropListRemoveLast);
+        *reinterpret_cast<QQmlListProperty<QObject> *>(args[0]) = nativeProp;
+        return;
+    }
+
     QQmlListProperty<QObject> declProp(
         qobj, this,
         append && append != Py_None ? &propListAppender : nullptr,
@@ -252,7 +618,15 @@ void QmlListPropertyPrivate::metaCall(PyObject *source, QMetaObject::Call call,
 
 static const char *PropertyList_SignatureStrings[] = {
     "PySide6.QtQml.ListProperty(self,type:type,append:typing.Callable,"
-        "at:typing.Callable=None,clear:typing.Callable=None,count:typing.Callable=None)",
+        "at:typing.Callable=None,clear:typing.Callable=None,count:typing.Callable=None,"
+        "replace:typing.Callable=None,removeLast:typing.Callable=None,*,native:bool=False)",
+    nullptr // Sentinel
+};
+
+static const char *ListPropertyView_SignatureStrings[] = {
+    "PySide6.QtQml.ListPropertyView.append(self,item:PySide6.QtCore.QObject)",
+    "PySide6.QtQml.ListPropertyView.clear(self)",
+    "PySide6.QtQml.ListPropertyView.removeLast(self)",
     nullptr // Sentinel
 };
 
@@ -267,12 +641,22 @@ void initQtQmlListProperty(PyObject *module)
         return;
     }
 
+    if (InitSignatureStrings(ListPropertyView_TypeF(), ListPropertyView_SignatureStrings) < 0) {
+        PyErr_Print();
+        qWarning() << "Error initializing ListPropertyView type.";
+        return;
+    }
+
     // Register QQmlListProperty metatype for use in QML
     qRegisterMetaType<QQmlListProperty<QObject>>();
 
     Py_INCREF(reinterpret_cast<PyObject *>(PropertyList_TypeF()));
     PyModule_AddObject(module, PepType_GetNameStr(PropertyList_TypeF()),
                        reinterpret_cast<PyObject *>(PropertyList_TypeF()));
+
+    Py_INCREF(reinterpret_cast<PyObject *>(ListPropertyView_TypeF()));
+    PyModule_AddObject(module, PepType_GetNameStr(ListPropertyView_TypeF()),
+                       reinterpret_cast<PyObject *>(ListPropertyView_TypeF()));
 }
 
 } // namespace PySide::Qml
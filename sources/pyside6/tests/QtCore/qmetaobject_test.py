@@ -13,6 +13,7 @@ sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
 from init_paths import init_test_paths
 init_test_paths(False)
 
+from shiboken6 import Shiboken
 from PySide6.QtCore import (QCoreApplication, QFile, QMetaObject, QObject,
                             QModelIndex, QPoint, QTimer, QSemaphore,
                             QStringListModel, Qt, Signal, Slot,
@@ -115,6 +116,37 @@ class qmetaobject_test(unittest.TestCase):
 
         #self.assertTrue(slot_index != signal_index)
 
+    def test_SharedDynamicSignals(self):
+        """Instances adding the same dynamic signals share their meta
+        objects, adding another signal to one of them must not affect the
+        others."""
+        receiver = DynObject()
+        senders = [QObject() for _ in range(3)]
+        for sender in senders:
+            receiver.connect(sender, SIGNAL("first()"), receiver.slot)
+        index = senders[0].metaObject().indexOfMethod("first()")
+        self.assertTrue(index > -1)
+        for sender in senders:
+            self.assertEqual(sender.metaObject().indexOfMethod("first()"), index)
+
+        receiver.connect(senders[2], SIGNAL("second()"), receiver.slot)
+        self.assertEqual(senders[2].metaObject().indexOfMethod("first()"), index)
+        self.assertEqual(senders[2].metaObject().indexOfMethod("second()"), index + 1)
+        self.assertEqual(senders[0].metaObject().indexOfMethod("second()"), -1)
+        del senders[0]
+        self.assertEqual(senders[0].metaObject().indexOfMethod("first()"), index)
+
+        # Adding the same signal to the remaining instance joins the meta
+        # object of the other one. The previous meta object stays valid.
+        old_meta_object = senders[0].metaObject()
+        old_method = old_meta_object.method(index)
+        receiver.connect(senders[0], SIGNAL("second()"), receiver.slot)
+        self.assertEqual(senders[0].metaObject().indexOfMethod("second()"), index + 1)
+        self.assertEqual(Shiboken.getCppPointer(senders[0].metaObject()),
+                         Shiboken.getCppPointer(senders[1].metaObject()))
+        self.assertEqual(old_method.methodSignature(), b"first()")
+        self.assertEqual(old_meta_object.indexOfMethod("second()"), -1)
+
     # PYSIDE-784, plain Qt objects should not have intermediary
     # metaObjects.
     def test_PlainQObject(self):
@@ -190,6 +222,28 @@ class qmetaobject_test(unittest.TestCase):
                                  Q_ARG("QVariant", "bla"))
         self.assertEqual(model.data(index), "bla")
 
+    def test_InvokeRepeatedly(self):
+        """The slot is looked up on each invocation, so that replacing
+           the method in the class or shadowing it in the instance works
+           after the first call."""
+        tester = InvokeTester()
+        for i in range(3):
+            sum = QMetaObject.invokeMethod(tester, "add", Q_RETURN_ARG(int),
+                                           Q_ARG(int, i), Q_ARG(int, 3))
+            self.assertEqual(sum, i + 3)
+
+        class Subtracter(InvokeTester):
+            @Slot(int, int, result=int)
+            def add(self, a, b):
+                return a - b
+
+        subtracter = Subtracter()
+        self.assertEqual(QMetaObject.invokeMethod(subtracter, "add", Q_RETURN_ARG(int),
+                                                  Q_ARG(int, 5), Q_ARG(int, 3)), 2)
+        subtracter.add = lambda a, b: a * b
+        self.assertEqual(QMetaObject.invokeMethod(subtracter, "add", Q_RETURN_ARG(int),
+                                                  Q_ARG(int, 5), Q_ARG(int, 3)), 15)
+
 
 if __name__ == '__main__':
     unittest.main()
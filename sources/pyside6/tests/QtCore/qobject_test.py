@@ -91,6 +91,27 @@ class ObjectNameCase(unittest.TestCase):
         obj.emitSignal()
         self.assertEqual(receiver.count(), 1)
 
+    def testMissingAttribute(self):
+        # Repeated probing of missing attributes must not hide attributes
+        # added later to the instance or the class.
+        obj = Obj()
+        for _ in range(3):
+            self.assertFalse(hasattr(obj, "missingAttribute"))
+            self.assertIsNone(getattr(obj, "missingAttribute", None))
+        with self.assertRaises(AttributeError) as cm:
+            obj.missingAttribute
+        self.assertIn("missingAttribute", str(cm.exception))
+        obj.missingAttribute = 42
+        self.assertEqual(obj.missingAttribute, 42)
+
+        self.assertFalse(hasattr(obj, "missingClassAttribute"))
+        Obj.missingClassAttribute = 43
+        self.assertEqual(obj.missingClassAttribute, 43)
+        del Obj.missingClassAttribute
+        self.assertFalse(hasattr(obj, "missingClassAttribute"))
+        # Meta methods are still found
+        self.assertTrue(hasattr(obj, "deleteLater"))
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -11,7 +11,7 @@ from init_paths import init_test_paths
 init_test_paths(False)
 
 from PySide6.QtCore import Property, QSize
-from PySide6.QtWidgets import QApplication, QMainWindow, QWidget
+from PySide6.QtWidgets import QApplication, QHBoxLayout, QMainWindow, QWidget
 
 is_pypy = hasattr(sys, "pypy_version_info")
 if not is_pypy:
@@ -52,6 +52,30 @@ class FeatureTest(unittest.TestCase):
         # Works with the same window! window = Window()
         window.set_window_title('snake_case')
 
+    def testAlternatingTypes(self):
+        """The feature set is remembered per type, alternating between
+        types with a common base must still switch correctly."""
+        window = Window()
+        layout = QHBoxLayout()
+        for _ in range(3):
+            window.setObjectName("window")
+            layout.setObjectName("layout")
+        self.assertFalse(hasattr(window, "set_object_name"))
+
+        from __feature__ import snake_case
+
+        for _ in range(3):
+            window.set_object_name("window")
+            layout.set_object_name("layout")
+            self.assertEqual(window.object_name(), "window")
+            self.assertEqual(layout.object_name(), "layout")
+        self.assertFalse(hasattr(layout, "setObjectName"))
+
+        feature.reset()
+
+        self.assertEqual(window.objectName(), "window")
+        self.assertEqual(layout.objectName(), "layout")
+
     def testPropertyAppearVanish(self):
         window = Window()
 
@@ -10,8 +10,12 @@ sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
 from init_paths import init_test_paths
 init_test_paths(False)
 
-from PySide6.QtCore import QObject
-from PySide6.QtQml import ListProperty
+from PySide6.QtCore import QCoreApplication, QMetaObject, QObject, QUrl
+from PySide6.QtQml import ListProperty, QmlElement, QQmlComponent, QQmlEngine
+
+
+QML_IMPORT_NAME = "NativeListProperty"
+QML_IMPORT_MAJOR_VERSION = 1
 
 
 class InheritsQObject(QObject):
@@ -22,6 +26,43 @@ def dummyFunc():
     pass
 
 
+class NativeListOwner(QObject):
+    items = ListProperty(InheritsQObject, native=True)
+
+
+@QmlElement
+class NativeListItem(QObject):
+    pass
+
+
+@QmlElement
+class QmlNativeListOwner(QObject):
+    items = ListProperty(NativeListItem, native=True)
+
+
+QML_SOURCE = b"""
+import NativeListProperty
+
+QmlNativeListOwner {
+    property int itemCount: -1
+    property string lastName
+
+    items: [
+        NativeListItem { objectName: "first" },
+        NativeListItem { objectName: "second" }
+    ]
+
+    function inspect() {
+        itemCount = items.length
+        lastName = items.length > 0 ? items[items.length - 1].objectName : ""
+    }
+    function clearItems() { items = [] }
+
+    Component.onCompleted: inspect()
+}
+"""
+
+
 class TestListProperty(unittest.TestCase):
     def testIt(self):
 
@@ -62,6 +103,63 @@ class TestListProperty(unittest.TestCase):
 
         self.assertTrue(method_check_error)
 
+    def testNative(self):
+        # Accessor functions cannot be combined with native storage
+        with self.assertRaises(TypeError):
+            ListProperty(QObject, append=dummyFunc, native=True)
+
+        owner = NativeListOwner()
+        items = owner.items
+        self.assertEqual(len(items), 0)
+        first = InheritsQObject()
+        second = InheritsQObject()
+        items.append(first)
+        items.append(second)
+        # The view is live and shared between accesses
+        self.assertEqual(len(owner.items), 2)
+        self.assertIs(owner.items[0], first)
+        self.assertIs(owner.items[1], second)
+        with self.assertRaises(IndexError):
+            owner.items[2]
+        with self.assertRaises(TypeError):
+            items.append(QObject())
+
+        third = InheritsQObject()
+        items[0] = third
+        self.assertIs(items[0], third)
+        items.removeLast()
+        self.assertEqual(len(items), 1)
+        items.clear()
+        self.assertEqual(len(items), 0)
+
+    def testNativeFromQml(self):
+        app = QCoreApplication.instance() or QCoreApplication(sys.argv)  # noqa: F841
+        engine = QQmlEngine()
+        component = QQmlComponent(engine)
+        component.setData(QML_SOURCE, QUrl())
+        owner = component.create()
+        self.assertTrue(owner, "\n".join(str(e) for e in component.errors()))
+
+        # Items appended by QML are visible in Python and read back by QML
+        self.assertEqual(owner.property("itemCount"), 2)
+        self.assertEqual(owner.property("lastName"), "second")
+        self.assertEqual(len(owner.items), 2)
+        self.assertEqual(owner.items[0].objectName(), "first")
+
+        # Items appended by Python are visible in QML
+        third = NativeListItem()
+        third.setObjectName("third")
+        owner.items.append(third)
+        QMetaObject.invokeMethod(owner, "inspect")
+        self.assertEqual(owner.property("itemCount"), 3)
+        self.assertEqual(owner.property("lastName"), "third")
+
+        # Clearing from QML updates the Python side
+        QMetaObject.invokeMethod(owner, "clearItems")
+        self.assertEqual(len(owner.items), 0)
+        QMetaObject.invokeMethod(owner, "inspect")
+        self.assertEqual(owner.property("itemCount"), 0)
+
 
 if __name__ == '__main__':
     unittest.main()
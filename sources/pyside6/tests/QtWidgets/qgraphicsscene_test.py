@@ -200,6 +200,20 @@ class TestGraphicsGroup(UsesQApplication):
         scene.destroyItemGroup(group)
         self.assertRaises(RuntimeError, group.type)
 
+    def testClear(self):
+        scene = QGraphicsScene()
+        kept = [scene.addRect(i, i, 10, 10) for i in range(100)]
+        for i in range(100):
+            scene.addEllipse(i, i, 10, 10)
+        parent = QGraphicsRectItem()
+        child = QGraphicsRectItem(parent)
+        scene.addItem(parent)
+        scene.clear()
+        self.assertEqual(scene.items(), [])
+        for item in kept:
+            self.assertRaises(RuntimeError, item.type)
+        self.assertRaises(RuntimeError, child.type)
+
     def testCustomScene(self):  # For PYSIDE-868, see above
         scene = CustomScene()
         view = QGraphicsView(scene)
@@ -15,6 +15,7 @@ from helper.usesqapplication import UsesQApplication
 from PySide6.QtCore import QTimer
 from PySide6.QtWidgets import (QFormLayout, QHBoxLayout, QLayout, QPushButton,
                                QSpacerItem, QWidget, QWidgetItem)
+from shiboken6 import Shiboken
 
 
 class MyLayout(QLayout):
@@ -102,6 +103,24 @@ class QLayoutTest(UsesQApplication):
 
         self.assertEqual(sys.getrefcount(b), 2)
 
+    @unittest.skipUnless(hasattr(sys, "getrefcount"), f"{sys.implementation.name} has no refcount")
+    def testItemOwnershipWithoutWrapper(self):
+        """The items of a nested layout are created in C++, their parent is
+           applied when they get a wrapper."""
+        w = QWidget()
+        outer = QHBoxLayout(w)
+        inner = QHBoxLayout()
+        inner.addWidget(QPushButton("test"))
+        outer.addLayout(inner)
+
+        item = inner.itemAt(0)
+        self.assertEqual(sys.getrefcount(item), 3)
+        self.assertFalse(Shiboken.ownedByPython(item))
+
+        del w
+        gc.collect()
+        self.assertFalse(Shiboken.isValid(item))
+
     def testMissingFunctions(self):
         w = QWidget()
         b = QPushButton("test")
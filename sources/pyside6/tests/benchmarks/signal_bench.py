@@ -0,0 +1,281 @@
+#!/usr/bin/env python
+# Copyright (C) 2022 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+'''Micro benchmarks of signals, slots and properties of libpyside.
+
+The benchmarks cover the paths through SignalManager, GlobalReceiverV2 and
+MetaObjectBuilder: Emitting signals to Python and C++ receivers, queued
+delivery to another thread, connecting and disconnecting, reading
+properties and registering many dynamic slots.
+
+For each benchmark, the time per operation and the number of memory blocks
+still allocated per operation after the run are reported, see
+benchmark_runner.py. The dynamic slots benchmark also reports the growth
+of the meta objects.
+
+The results are written as JSON with --output, --compare prints the
+relative timings to the JSON file of a previous run:
+
+    python signal_bench.py --output base.json
+    (change libpyside)
+    python signal_bench.py --compare base.json
+
+Run it through the "pyside_benchmarks" CMake target or with BUILD_DIR set
+as for the tests.'''
+
+import os
+import sys
+import threading
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from benchmark_runner import Benchmarks
+
+import PySide6
+from shiboken6 import Shiboken
+from PySide6.QtCore import (QCoreApplication, QObject, QThread, QTimer, Property,
+                            Qt, Signal, Slot)
+
+
+benchmarks = Benchmarks()
+
+
+class Sender(QObject):
+    signal0 = Signal()
+    signal1 = Signal(int)
+    signal4 = Signal(int, str, float, object)
+
+
+class Receiver(QObject):
+    def __init__(self):
+        super().__init__()
+        self.count = 0
+
+    @Slot()
+    def slot0(self):
+        self.count += 1
+
+    @Slot(int)
+    def slot1(self, value):
+        self.count += 1
+
+    @Slot(int, str, float, object)
+    def slot4(self, a, b, c, d):
+        self.count += 1
+
+
+class PropertyObject(QObject):
+    def __init__(self):
+        super().__init__()
+        self._value = 42
+
+    def getValue(self):
+        return self._value
+
+    def setValue(self, value):
+        self._value = value
+
+    value = Property(int, getValue, setValue)
+
+
+def function0():
+    pass
+
+
+def function1(value):
+    pass
+
+
+def function4(a, b, c, d):
+    pass
+
+
+@benchmarks.register
+def emit_0_args_to_function(loops):
+    sender = Sender()
+    sender.signal0.connect(function0)
+    for _ in range(loops):
+        sender.signal0.emit()
+
+
+@benchmarks.register
+def emit_1_arg_to_function(loops):
+    sender = Sender()
+    sender.signal1.connect(function1)
+    for i in range(loops):
+        sender.signal1.emit(i)
+
+
+@benchmarks.register
+def emit_4_args_to_function(loops):
+    sender = Sender()
+    sender.signal4.connect(function4)
+    data = {}
+    for i in range(loops):
+        sender.signal4.emit(i, "text", 1.5, data)
+
+
+@benchmarks.register
+def emit_0_args_to_slot(loops):
+    sender = Sender()
+    receiver = Receiver()
+    sender.signal0.connect(receiver.slot0)
+    for _ in range(loops):
+        sender.signal0.emit()
+
+
+@benchmarks.register
+def emit_1_arg_to_slot(loops):
+    sender = Sender()
+    receiver = Receiver()
+    sender.signal1.connect(receiver.slot1)
+    for i in range(loops):
+        sender.signal1.emit(i)
+
+
+@benchmarks.register
+def emit_4_args_to_slot(loops):
+    sender = Sender()
+    receiver = Receiver()
+    sender.signal4.connect(receiver.slot4)
+    data = {}
+    for i in range(loops):
+        sender.signal4.emit(i, "text", 1.5, data)
+
+
+@benchmarks.register
+def emit_to_cpp_slot(loops):
+    '''Python signal connected to a C++ slot.'''
+    sender = Sender()
+    timer = QTimer()
+    sender.signal0.connect(timer.stop)
+    for _ in range(loops):
+        sender.signal0.emit()
+
+
+@benchmarks.register
+def cpp_signal_to_function(loops):
+    '''C++ signal emitted from C++ received by a Python callable.'''
+    sender = QObject()
+    sender.objectNameChanged.connect(function1)
+    names = ("a", "b")
+    for i in range(loops):
+        sender.setObjectName(names[i & 1])
+
+
+@benchmarks.register
+def queued_to_thread(loops):
+    '''Queued delivery to a receiver living in another thread.'''
+    done = threading.Event()
+
+    class ThreadReceiver(QObject):
+        @Slot(int)
+        def receive(self, value):
+            if value == loops - 1:
+                done.set()
+
+    thread = QThread()
+    receiver = ThreadReceiver()
+    receiver.moveToThread(thread)
+    thread.start()
+    sender = Sender()
+    sender.signal1.connect(receiver.receive, Qt.QueuedConnection)
+    for i in range(loops):
+        sender.signal1.emit(i)
+    done.wait()
+    thread.quit()
+    thread.wait()
+
+
+@benchmarks.register
+def connect_disconnect_function(loops):
+    sender = Sender()
+    for _ in range(loops):
+        sender.signal1.connect(function1)
+        sender.signal1.disconnect(function1)
+
+
+@benchmarks.register
+def connect_disconnect_slot(loops):
+    sender = Sender()
+    receiver = Receiver()
+    for _ in range(loops):
+        sender.signal1.connect(receiver.slot1)
+        sender.signal1.disconnect(receiver.slot1)
+
+
+@benchmarks.register
+def property_read(loops):
+    obj = PropertyObject()
+    for _ in range(loops):
+        obj.property("value")
+
+
+@benchmarks.register
+def property_attribute_read(loops):
+    obj = PropertyObject()
+    for _ in range(loops):
+        obj.value
+
+
+DYNAMIC_SLOT_COUNT = 50
+
+
+def _dynamic_slot(self, value):
+    pass
+
+
+# Methods without @Slot decoration are added to the meta object of the
+# receiver instance when connected.
+DynamicReceiver = type("DynamicReceiver", (QObject,),
+                       {f"method{i}": _dynamic_slot for i in range(DYNAMIC_SLOT_COUNT)})
+
+
+def dynamic_slot_counters():
+    '''Return the number of methods added to the meta object of a receiver
+    by connecting to its methods, and the number of meta objects created per
+    receiver, which should be one.'''
+    count = 10
+    sender = Sender()
+    static_method_count = DynamicReceiver.staticMetaObject.methodCount()
+    receivers = []
+    meta_objects = set()
+    for _ in range(count):
+        receiver = DynamicReceiver()
+        for i in range(DYNAMIC_SLOT_COUNT):
+            sender.signal1.connect(getattr(receiver, f"method{i}"))
+            meta_objects.add(Shiboken.getCppPointer(receiver.metaObject())[0])
+        receivers.append(receiver)
+    added_methods = [r.metaObject().methodCount() - static_method_count for r in receivers]
+    return {"methods/op": sum(added_methods) / count,
+            "metaobjects/op": len(meta_objects) / count}
+
+
+@benchmarks.register(counters=dynamic_slot_counters)
+def dynamic_slots(loops):
+    '''Connecting to 50 methods of a receiver, each adding a dynamic slot.
+    One operation is one receiver.'''
+    sender = Sender()
+    for _ in range(loops):
+        receiver = DynamicReceiver()
+        for i in range(DYNAMIC_SLOT_COUNT):
+            sender.signal1.connect(getattr(receiver, f"method{i}"))
+        sender.signal1.emit(1)
+        del receiver
+
+
+def main():
+    def setup():
+        global app
+        app = QCoreApplication.instance() or QCoreApplication([])
+
+    versions = {"pyside": PySide6.__version__, "qt": PySide6.QtCore.qVersion()}
+    return benchmarks.main(__doc__, versions, setup)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
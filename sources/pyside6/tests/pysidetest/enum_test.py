@@ -10,7 +10,7 @@ sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
 from init_paths import init_test_paths
 init_test_paths(True)
 
-from PySide6.QtCore import Qt
+from PySide6.QtCore import QObject, Qt
 from testbinding import Enum1, TestObjectWithoutNamespace
 
 import dis
@@ -159,6 +159,34 @@ class InvestigateOpcodesTest(unittest.TestCase):
         self.assertEqual(self.read_code(self.probe_function1), result_1)
         self.assertEqual(self.read_code(self.probe_function2), result_2)
 
+    def testRepeatedAccess(self):
+        # The result of the opcode inspection is cached per code location,
+        # repeated access from the same locations must not be affected.
+        for _ in range(20):
+            self.assertEqual(Qt.Alignment(), Qt.Alignment(0))
+            self.assertEqual(Qt.AlignLeft, Qt.AlignmentFlag.AlignLeft)
+            self.assertTrue(isinstance(Qt.AlignmentFlag(0), Qt.AlignmentFlag))
+
+    def testShortcutsOfAssignedEnum(self):
+        # Enum values of an enum assigned to a base class are found in
+        # subclasses; other assignments do not rebuild the lookup.
+        import enum
+
+        class Derived(QObject):
+            pass
+
+        class Probe(enum.Enum):
+            ProbeValue = 1
+
+        self.assertRaises(AttributeError, getattr, Derived, "ProbeValue")
+        Derived.counter = 1
+        QObject.ProbeEnum = Probe
+        try:
+            self.assertEqual(Derived.ProbeValue, Probe.ProbeValue)
+        finally:
+            del QObject.ProbeEnum
+        self.assertRaises(AttributeError, getattr, Derived, "ProbeValue")
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,106 @@
+# Copyright (C) 2022 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+'''Test cases for QObject.connectMany() and QObject.disconnectMany()'''
+
+import os
+import sys
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QObject, Signal, Slot, SIGNAL, SLOT
+
+
+class Sender(QObject):
+    valueChanged = Signal(int)
+
+
+class Receiver(QObject):
+    def __init__(self):
+        super().__init__()
+        self.values = []
+
+    @Slot(int)
+    def setValue(self, value):
+        self.values.append(value)
+
+
+class Collector:
+    def __init__(self):
+        self.values = []
+
+    def collect(self, value):
+        self.values.append(value)
+
+
+class ConnectManyTest(unittest.TestCase):
+
+    def testConnectMany(self):
+        senders = [Sender() for i in range(10)]
+        receiver = Receiver()
+        received = []
+        connections = []
+        for sender in senders:
+            connections.append((sender.valueChanged, received.append))
+            connections.append((sender, SIGNAL("valueChanged(int)"), receiver.setValue))
+            connections.append((sender, SIGNAL("valueChanged(int)"),
+                                receiver, SLOT("setValue(int)")))
+        result = QObject.connectMany(connections)
+        self.assertEqual(len(result), len(connections))
+        self.assertTrue(all(result))
+        for i, sender in enumerate(senders):
+            sender.valueChanged.emit(i)
+        self.assertEqual(received, list(range(10)))
+        self.assertEqual(receiver.values, [i for i in range(10) for _ in range(2)])
+
+        self.assertTrue(all(QObject.disconnectMany(connections)))
+        senders[0].valueChanged.emit(42)
+        self.assertEqual(len(received), 10)
+        self.assertEqual(len(receiver.values), 20)
+
+    def testDynamicSignals(self):
+        senders = [QObject() for i in range(10)]
+        received = []
+        connections = [(sender, SIGNAL("dynamic(int)"), received.append) for sender in senders]
+        self.assertTrue(all(QObject.connectMany(connections)))
+        for i, sender in enumerate(senders):
+            sender.emit(SIGNAL("dynamic(int)"), i)
+        self.assertEqual(received, list(range(10)))
+
+    def testSharedFunctions(self):
+        '''The argument counts are determined per function and signal.'''
+        senders = [Sender() for i in range(3)]
+        collectors = [Collector() for i in range(3)]
+        calls = []
+        connections = []
+        for sender, collector in zip(senders, collectors):
+            connections.append((sender.valueChanged, collector.collect))
+            connections.append((sender.valueChanged, lambda: calls.append(None)))
+            connections.append((sender.valueChanged, lambda value: calls.append(value)))
+        self.assertTrue(all(QObject.connectMany(connections)))
+        for i, sender in enumerate(senders):
+            sender.valueChanged.emit(i)
+        self.assertEqual([c.values for c in collectors], [[0], [1], [2]])
+        self.assertEqual(calls, [None, 0, None, 1, None, 2])
+
+    def testInvalidInput(self):
+        sender = Sender()
+        self.assertRaises(TypeError, QObject.connectMany, 42)
+        self.assertRaises(TypeError, QObject.connectMany, [()])
+        self.assertRaises(TypeError, QObject.connectMany, [(sender,)])
+        self.assertRaises(TypeError, QObject.connectMany,
+                          [(sender, "valueChanged(int)", print)])
+        self.assertRaises(TypeError, QObject.connectMany,
+                          [(sender, SIGNAL("valueChanged(int)"), 42)])
+        receiver = Receiver()
+        self.assertRaises(TypeError, QObject.connectMany,
+                          [(sender, SIGNAL("valueChanged(int)"), receiver, "setValue(int)")])
+        self.assertEqual(sender.receivers(SIGNAL("valueChanged(int)")), 0)
+
+
+if __name__ == '__main__':
+    unittest.main()
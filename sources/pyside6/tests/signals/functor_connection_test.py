@@ -0,0 +1,118 @@
+# Copyright (C) 2022 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+'''Test cases for connecting signals to Python callables which are not slots of a QObject'''
+
+import gc
+import os
+import sys
+import threading
+import unittest
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide6.QtCore import QObject, Qt, Signal, SIGNAL
+
+
+class Sender(QObject):
+    valueChanged = Signal(int, str)
+
+
+class Collector:
+    def __init__(self):
+        self.values = []
+
+    def collect(self, value):
+        self.values.append(value)
+
+
+class FunctorConnectionTest(unittest.TestCase):
+
+    def testArguments(self):
+        sender = Sender()
+        received = []
+        sender.valueChanged.connect(lambda *args: received.append(args))
+        sender.valueChanged.connect(lambda value: received.append(value))
+        sender.valueChanged.connect(lambda: received.append(None))
+        sender.valueChanged.emit(42, "x")
+        self.assertEqual(received, [(42, "x"), 42, None])
+
+    def testDisconnectOne(self):
+        sender = Sender()
+        received = []
+
+        def callback(value, text):
+            received.append(value)
+
+        sender.valueChanged.connect(callback)
+        sender.valueChanged.connect(callback)
+        self.assertEqual(sender.receivers(SIGNAL("valueChanged(int,QString)")), 2)
+        self.assertTrue(sender.valueChanged.disconnect(callback))
+        sender.valueChanged.emit(1, "")
+        self.assertEqual(received, [1])
+        self.assertTrue(sender.valueChanged.disconnect(callback))
+        self.assertEqual(sender.receivers(SIGNAL("valueChanged(int,QString)")), 0)
+
+    def testDisconnectOtherCallable(self):
+        sender = Sender()
+        received = []
+
+        def first(value, text):
+            received.append(("first", value))
+
+        def second(value, text):
+            received.append(("second", value))
+
+        sender.valueChanged.connect(first)
+        sender.valueChanged.connect(second)
+        self.assertTrue(sender.valueChanged.disconnect(first))
+        sender.valueChanged.emit(1, "")
+        self.assertEqual(received, [("second", 1)])
+
+    def testConnectFromExitedThread(self):
+        sender = Sender()
+        received = []
+
+        def connect():
+            sender.valueChanged.connect(lambda value: received.append(value))
+
+        thread = threading.Thread(target=connect)
+        thread.start()
+        thread.join()
+        sender.valueChanged.emit(1, "")
+        self.assertEqual(received, [1])
+
+    def testDisconnectConnection(self):
+        sender = Sender()
+        received = []
+        connection = sender.valueChanged.connect(lambda value: received.append(value))
+        sender.valueChanged.disconnect(connection)
+        sender.valueChanged.emit(1, "")
+        self.assertEqual(received, [])
+
+    def testMethodOfDeletedInstance(self):
+        sender = Sender()
+        collector = Collector()
+        sender.valueChanged.connect(collector.collect)
+        sender.valueChanged.emit(1, "")
+        self.assertEqual(collector.values, [1])
+        del collector
+        gc.collect()
+        self.assertEqual(sender.receivers(SIGNAL("valueChanged(int,QString)")), 0)
+        sender.valueChanged.emit(2, "")
+
+    def testUniqueConnection(self):
+        sender = Sender()
+
+        def callback():
+            pass
+
+        self.assertTrue(sender.valueChanged.connect(callback, Qt.UniqueConnection))
+        self.assertFalse(sender.valueChanged.connect(callback, Qt.UniqueConnection))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -2,7 +2,8 @@
 # SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
 
 '''Test case for PYSIDE-1354: Ensure that slots are invoked from the receiver's
-thread context when using derived classes (and thus, a global receiver).'''
+thread context when using derived classes (and thus, a global receiver), and
+that plain callables are invoked from the connecting thread.'''
 
 import os
 import sys
@@ -77,6 +78,16 @@ class SignalAcrossThreads(UsesQCoreApplication):
         self.assertEqual(worker_thread_receiver.senderThread, self._worker_thread)
         self.assertEqual(main_thread_receiver.senderThread, main_thread)
 
+    def testCallable(self):
+        main_thread = QThread.currentThread()
+        threads = []
+        self._worker_thread.started.connect(lambda: threads.append(QThread.currentThread()))
+
+        self._timer.start()
+        self.app.exec()
+
+        self.assertEqual(threads, [main_thread])
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -7,11 +7,21 @@
 #include "compilersupport.h"
 
 #include <QtCore/QByteArrayList>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
 #include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QRegularExpression>
+#include <QtCore/QSaveFile>
 #include <QtCore/QScopedArrayPointer>
+#include <QtCore/QSet>
 #include <QtCore/QString>
+#include <QtCore/QVersionNumber>
+
+using namespace Qt::StringLiterals;
 
 namespace clang {
 
@@ -230,14 +240,12 @@ static QByteArray msgCreateTranslationUnit(const QByteArrayList &clangArgs, unsi
     return result;
 }
 
-static CXTranslationUnit createTranslationUnit(CXIndex index,
-                                               const QByteArrayList &args,
-                                               bool addCompilerSupportArguments,
-                                               unsigned flags = 0)
-{
-    // courtesy qdoc
-    const unsigned defaultFlags = CXTranslationUnit_Incomplete;
+// courtesy qdoc
+static const unsigned defaultTranslationUnitFlags = CXTranslationUnit_Incomplete;
 
+static QByteArrayList translationUnitArguments(const QByteArrayList &args,
+                                               bool addCompilerSupportArguments)
+{
     static const QByteArrayList defaultArgs = {
 #ifndef Q_OS_WIN
         "-fPIC",
@@ -258,13 +266,20 @@ static CXTranslationUnit createTranslationUnit(CXIndex index,
     }
     clangArgs += detectVulkan();
     clangArgs += args;
+    return clangArgs;
+}
+
+static CXTranslationUnit createTranslationUnit(CXIndex index,
+                                               const QByteArrayList &clangArgs,
+                                               unsigned flags = 0)
+{
     QScopedArrayPointer<const char *> argv(byteArrayListToFlatArgV(clangArgs));
     qDebug().noquote().nospace() << msgCreateTranslationUnit(clangArgs, flags);
 
     CXTranslationUnit tu;
     CXErrorCode err = clang_parseTranslationUnit2(index, nullptr, argv.data(),
                                                   clangArgs.size(), nullptr, 0,
-                                                  defaultFlags | flags, &tu);
+                                                  defaultTranslationUnitFlags | flags, &tu);
     if (err || !tu) {
         qWarning().noquote().nospace() << "Could not parse "
             << clangArgs.constLast().constData() << ", error code: " << err;
@@ -273,11 +288,272 @@ static CXTranslationUnit createTranslationUnit(CXIndex index,
     return tu;
 }
 
+/* Translation unit cache: Parsed translation units are serialized using
+ * clang_saveTranslationUnit() into the cache directory and loaded by
+ * clang_createTranslationUnit2() when shiboken is run again with the same
+ * input.
+ *
+ * The source file passed by ApiExtractor is a temporary file with a random
+ * name which includes the global headers. Its contents are copied to
+ * "<key>.hpp" in the cache directory, which is parsed instead. The key is a
+ * hash of the libclang version, the parse flags, the arguments without the
+ * source file (include paths, compiler options) and the source contents
+ * (the headers). A dependency file "<key>.deps" listing all headers included
+ * by the translation unit with their size and modification time is stored
+ * along with the unit "<key>.ast"; the cached unit is discarded when any of
+ * them changes.
+ *
+ * The headers of base modules (--clang-cache-base-headers) are parsed into a
+ * precompiled header "<key>.pch" in the same way, which is passed to the
+ * parser by -include-pch. All modules depending on the same base modules
+ * share it.
+ *
+ * The access time of units is set when they are used; entries not used for
+ * translationUnitCacheMaxAgeDays are removed. */
+
+static constexpr int translationUnitCacheMaxAgeDays = 14;
+
+static QString translationUnitCacheKey(const QByteArrayList &clangArgs,
+                                       const QByteArray &source, unsigned flags)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(libClangVersion().toString().toLatin1());
+    hash.addData(QByteArray::number(defaultTranslationUnitFlags | flags));
+    for (const QByteArray &arg : clangArgs) {
+        hash.addData(arg);
+        hash.addData(QByteArrayView("\0", 1));
+    }
+    hash.addData(source);
+    return QString::fromLatin1(hash.result().toHex());
+}
+
+static bool isTranslationUnitCacheKey(const QString &key)
+{
+    static const QRegularExpression pattern(u"^[0-9a-f]{40}$"_s);
+    return pattern.match(key).hasMatch();
+}
+
+// Write the source file of a cache entry unless it exists.
+static QString writeCacheSourceFile(const QString &baseName, const QByteArray &source)
+{
+    const QString fileName = baseName + u".hpp"_s;
+    if (QFileInfo::exists(fileName))
+        return fileName;
+    if (!QDir().mkpath(QFileInfo(baseName).absolutePath()))
+        return {};
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly) || file.write(source) != source.size()
+        || !file.commit()) {
+        qWarning().noquote().nospace() << "Unable to write \""
+            << QDir::toNativeSeparators(fileName) << "\": " << file.errorString();
+        return {};
+    }
+    return fileName;
+}
+
+static QByteArray dependencyStamp(const QString &fileName)
+{
+    const QFileInfo fi(fileName);
+    if (!fi.isFile())
+        return {};
+    return QByteArray::number(fi.size()) + ' '
+        + QByteArray::number(fi.lastModified().toMSecsSinceEpoch());
+}
+
+static void inclusionVisitor(CXFile includedFile, CXSourceLocation *, unsigned,
+                             CXClientData clientData)
+{
+    auto *files = reinterpret_cast<QStringList *>(clientData);
+    files->append(getFileName(includedFile));
+}
+
+// Dependency file: One line per included file: "<size> <mtime>\t<path>"
+static QByteArray formatDependencies(CXTranslationUnit tu, const QStringList &extraFiles)
+{
+    QStringList files = extraFiles;
+    clang_getInclusions(tu, inclusionVisitor, &files);
+    files.removeDuplicates();
+    QByteArray result;
+    for (const QString &file : qAsConst(files)) {
+        const QByteArray stamp = dependencyStamp(file);
+        if (!stamp.isEmpty())
+            result += stamp + '\t' + QFile::encodeName(file) + '\n';
+    }
+    return result;
+}
+
+static bool dependenciesUpToDate(const QString &dependencyFileName)
+{
+    QFile file(dependencyFileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+    const QByteArrayList lines = file.readAll().split('\n');
+    for (const QByteArray &line : lines) {
+        if (line.isEmpty())
+            continue;
+        const auto tab = line.indexOf('\t');
+        if (tab < 0 || dependencyStamp(QFile::decodeName(line.mid(tab + 1))) != line.left(tab))
+            return false;
+    }
+    return true;
+}
+
+// Check whether a cached unit exists and is up to date, mark it as used by
+// setting the access time (the modification time of a precompiled header is
+// recorded in the dependencies of the units using it).
+static bool isCachedUnitValid(const QString &baseName, const QString &unitFileName)
+{
+    if (!QFileInfo::exists(unitFileName) || !dependenciesUpToDate(baseName + u".deps"_s))
+        return false;
+    QFile file(unitFileName);
+    if (file.open(QIODevice::ReadWrite))
+        file.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileAccessTime);
+    return true;
+}
+
+static CXTranslationUnit loadCachedTranslationUnit(CXIndex index, const QString &baseName)
+{
+    const QString astFileName = baseName + u".ast"_s;
+    if (!isCachedUnitValid(baseName, astFileName))
+        return nullptr;
+    CXTranslationUnit tu = nullptr;
+    const CXErrorCode err =
+        clang_createTranslationUnit2(index, QFile::encodeName(astFileName).constData(), &tu);
+    if (err != CXError_Success || tu == nullptr) {
+        qWarning().noquote().nospace() << "Unable to load cached translation unit \""
+            << QDir::toNativeSeparators(astFileName) << "\", error code: " << err;
+        return nullptr;
+    }
+    qDebug().noquote().nospace() << "Loaded cached translation unit \""
+        << QDir::toNativeSeparators(astFileName) << '"';
+    return tu;
+}
+
+static bool saveCachedTranslationUnit(CXTranslationUnit tu, const QString &unitFileName,
+                                      const QString &baseName,
+                                      const QStringList &extraDependencies = {})
+{
+    if (!QDir().mkpath(QFileInfo(baseName).absolutePath()))
+        return false;
+    // Save to a temporary file and rename to avoid concurrent shiboken
+    // processes reading a partially written unit.
+    const QString tempFileName = unitFileName + u'.'
+        + QString::number(QCoreApplication::applicationPid());
+    const QByteArray encodedTempFileName = QFile::encodeName(tempFileName);
+    const int err = clang_saveTranslationUnit(tu, encodedTempFileName.constData(),
+                                              clang_defaultSaveOptions(tu));
+    if (err != CXSaveError_None) {
+        qWarning().noquote().nospace() << "Unable to save translation unit to \""
+            << QDir::toNativeSeparators(unitFileName) << "\", error code: " << err;
+        QFile::remove(tempFileName);
+        return false;
+    }
+    QSaveFile dependencyFile(baseName + u".deps"_s);
+    if (!dependencyFile.open(QIODevice::WriteOnly)) {
+        QFile::remove(tempFileName);
+        return false;
+    }
+    dependencyFile.write(formatDependencies(tu, extraDependencies));
+    QFile::remove(unitFileName);
+    if (!QFile::rename(tempFileName, unitFileName) || !dependencyFile.commit()) {
+        QFile::remove(tempFileName);
+        return false;
+    }
+    return true;
+}
+
+// Return a precompiled header of the base module headers, parsing them
+// unless a cached one is up to date.
+static QString precompiledBaseHeaders(CXIndex index, const QByteArrayList &clangArgs,
+                                      unsigned flags)
+{
+    const QStringList &headers = translationUnitCacheBaseHeaders();
+    if (headers.isEmpty())
+        return {};
+
+    QByteArray source;
+    for (const QString &header : headers)
+        source += "#include \"" + QFile::encodeName(QDir::fromNativeSeparators(header)) + "\"\n";
+    flags |= CXTranslationUnit_ForSerialization;
+    const QString baseName = translationUnitCacheDirectory() + u'/'
+        + translationUnitCacheKey(clangArgs, source, flags);
+    const QString pchFileName = baseName + u".pch"_s;
+    if (isCachedUnitValid(baseName, pchFileName))
+        return pchFileName;
+
+    const QString sourceFileName = writeCacheSourceFile(baseName, source);
+    if (sourceFileName.isEmpty())
+        return {};
+    QByteArrayList pchArgs = clangArgs;
+    pchArgs.append(QFile::encodeName(sourceFileName));
+    CXTranslationUnit tu = createTranslationUnit(index, pchArgs, flags);
+    if (tu == nullptr)
+        return {};
+    bool ok = maxSeverity(getDiagnostics(tu)) < CXDiagnostic_Error;
+    if (ok)
+        ok = saveCachedTranslationUnit(tu, pchFileName, baseName);
+    else
+        qWarning().noquote() << "Errors in the base module headers, not precompiling them.";
+    clang_disposeTranslationUnit(tu);
+    return ok ? pchFileName : QString{};
+}
+
+// Remove entries of the cache directory which were not used for
+// translationUnitCacheMaxAgeDays and leftovers of interrupted runs.
+static void pruneTranslationUnitCache(const QString &directory)
+{
+    const QDateTime limit = QDateTime::currentDateTime().addDays(-translationUnitCacheMaxAgeDays);
+    const QFileInfoList files = QDir(directory).entryInfoList(QDir::Files);
+    QSet<QString> usedKeys;
+    for (const QFileInfo &fi : files) {
+        const QString suffix = fi.completeSuffix();
+        if ((suffix == u"ast" || suffix == u"pch") && fi.lastRead() >= limit)
+            usedKeys.insert(fi.baseName());
+    }
+    static const QStringList entrySuffixes{u"ast"_s, u"pch"_s, u"deps"_s, u"hpp"_s};
+    for (const QFileInfo &fi : files) {
+        const QString key = fi.baseName();
+        if (fi.lastModified() < limit && isTranslationUnitCacheKey(key)
+            && (!usedKeys.contains(key) || !entrySuffixes.contains(fi.completeSuffix()))) {
+            QFile::remove(fi.absoluteFilePath());
+        }
+    }
+}
+
+// Prepare the arguments for parsing using the cache: Replace the source file
+// by a copy in the cache directory and add the precompiled base headers.
+// Returns the base name of the cache entry.
+static QString prepareCachedTranslationUnit(CXIndex index, QByteArrayList *clangArgs,
+                                            unsigned flags, QStringList *extraDependencies)
+{
+    QFile sourceFile(QFile::decodeName(clangArgs->constLast()));
+    if (!sourceFile.open(QIODevice::ReadOnly))
+        return {};
+    const QByteArray source = sourceFile.readAll();
+    sourceFile.close();
+
+    QByteArrayList args = *clangArgs;
+    args.removeLast();
+    const QString pchFileName = precompiledBaseHeaders(index, args, flags);
+    if (!pchFileName.isEmpty()) {
+        args << QByteArrayLiteral("-include-pch") << QFile::encodeName(pchFileName);
+        extraDependencies->append(pchFileName);
+    }
+    const QString baseName = translationUnitCacheDirectory() + u'/'
+        + translationUnitCacheKey(args, source, flags);
+    const QString cacheSourceFileName = writeCacheSourceFile(baseName, source);
+    if (cacheSourceFileName.isEmpty())
+        return {};
+    args.append(QFile::encodeName(cacheSourceFileName));
+    *clangArgs = args;
+    return baseName;
+}
+
 /* clangFlags are flags to clang_parseTranslationUnit2() such as
  * CXTranslationUnit_KeepGoing (from CINDEX_VERSION_MAJOR/CINDEX_VERSION_MINOR 0.35)
  */
 
-bool parse(const QByteArrayList  &clangArgs, bool addCompilerSupportArguments,
+bool parse(const QByteArrayList  &args, bool addCompilerSupportArguments,
            unsigned clangFlags, BaseVisitor &bv)
 {
     CXIndex index = clang_createIndex(0 /* excludeDeclarationsFromPCH */,
@@ -287,9 +563,21 @@ bool parse(const QByteArrayList  &clangArgs, bool addCompilerSupportArguments,
         return false;
     }
 
-    CXTranslationUnit translationUnit =
-        createTranslationUnit(index, clangArgs, addCompilerSupportArguments,
-                              clangFlags);
+    QByteArrayList clangArgs = translationUnitArguments(args, addCompilerSupportArguments);
+
+    QString cacheBaseName;
+    QStringList extraDependencies;
+    CXTranslationUnit translationUnit = nullptr;
+    const QString &cacheDir = translationUnitCacheDirectory();
+    if (!cacheDir.isEmpty()) {
+        cacheBaseName = prepareCachedTranslationUnit(index, &clangArgs, clangFlags,
+                                                     &extraDependencies);
+        if (!cacheBaseName.isEmpty())
+            translationUnit = loadCachedTranslationUnit(index, cacheBaseName);
+    }
+    const bool fromCache = translationUnit != nullptr;
+    if (!fromCache)
+        translationUnit = createTranslationUnit(index, clangArgs, clangFlags);
     if (!translationUnit)
         return false;
 
@@ -312,8 +600,15 @@ bool parse(const QByteArrayList  &clangArgs, bool addCompilerSupportArguments,
             debug << diagnostic << '\n';
     }
 
+    if (ok && !fromCache && !cacheBaseName.isEmpty()) {
+        saveCachedTranslationUnit(translationUnit, cacheBaseName + u".ast"_s,
+                                  cacheBaseName, extraDependencies);
+    }
+
     clang_disposeTranslationUnit(translationUnit);
     clang_disposeIndex(index);
+    if (!cacheDir.isEmpty())
+        pruneTranslationUnitCache(cacheDir);
     return ok;
 }
 
@@ -69,6 +69,30 @@ void setCompilerPath(const QString &name)
     _compilerPath = name;
 }
 
+QString _translationUnitCacheDirectory; // From command line
+
+const QString &translationUnitCacheDirectory()
+{
+    return _translationUnitCacheDirectory;
+}
+
+void setTranslationUnitCacheDirectory(const QString &directory)
+{
+    _translationUnitCacheDirectory = directory;
+}
+
+QStringList _translationUnitCacheBaseHeaders; // From command line
+
+const QStringList &translationUnitCacheBaseHeaders()
+{
+    return _translationUnitCacheBaseHeaders;
+}
+
+void setTranslationUnitCacheBaseHeaders(const QStringList &headers)
+{
+    _translationUnitCacheBaseHeaders = headers;
+}
+
 static Platform _platform =
 #if defined (Q_OS_DARWIN)
     Platform::macOS;
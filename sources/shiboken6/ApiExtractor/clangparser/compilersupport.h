@@ -5,6 +5,7 @@
 #define COMPILERSUPPORT_H
 
 #include <QtCore/QByteArrayList>
+#include <QtCore/QStringList>
 
 QT_FORWARD_DECLARE_CLASS(QVersionNumber)
 QT_FORWARD_DECLARE_CLASS(QString)
@@ -49,6 +50,14 @@ void setCompilerPath(const QString &name);
 
 Platform platform();
 bool setPlatform(const QString &name);
+
+// Directory for caching parsed translation units between runs (empty: off)
+const QString &translationUnitCacheDirectory();
+void setTranslationUnitCacheDirectory(const QString &directory);
+
+// Headers of base modules to be precompiled into the cache directory
+const QStringList &translationUnitCacheBaseHeaders();
+void setTranslationUnitCacheBaseHeaders(const QStringList &headers);
 } // namespace clang
 
 #endif // COMPILERSUPPORT_H
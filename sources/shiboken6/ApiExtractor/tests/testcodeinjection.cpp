@@ -33,6 +33,11 @@ void TestCodeInjections::testReadFile_data()
         << QString::fromLatin1(":/injectedcode.txt")
         << QString::fromLatin1("label")
         << QString::fromLatin1("code line");
+
+    QTest::newRow("second snippet")
+        << QString::fromLatin1(":/injectedcode.txt")
+        << QString::fromLatin1("label2")
+        << QString::fromLatin1("other code line");
 }
 
 void TestCodeInjections::testReadFile()
@@ -10,12 +10,26 @@
 class TypeDatabase;
 class SmartPointerTypeEntry;
 
+// Contents of a file used for code injection, indexed by snippet label
+struct SnippetFile
+{
+    QString code;
+    QHash<QString, QString> snippets;
+};
+
 struct TypeDatabaseParserContext
 {
     using SmartPointerInstantiations = QHash<SmartPointerTypeEntry *, QString>;
+    using SnippetFiles = QHash<QString, SnippetFile>;
 
     TypeDatabase *db;
     SmartPointerInstantiations smartPointerInstantiations;
+    // Code injection files by resolved path. Files like the PySide glue
+    // code are referenced from hundreds of <inject-code> elements across
+    // the typesystem files loaded via <load-typesystem>. The index lives for
+    // one run only; the parsed type entries are not cached across runs, the
+    // typesystem files are parsed by each run.
+    SnippetFiles snippetFiles;
 };
 
 #endif // TYPEDATABASE_P_H
@@ -188,6 +188,45 @@ std::optional<QString>
     return CodeSnipAbstract::fixSpaces(result);
 }
 
+// Index all snippets of a file within annotations "// @snippet label" in
+// one pass. The semantics match extractSnippet(): a snippet extends to the
+// next annotation with the same label, annotations of other labels are
+// part of the code.
+static SnippetFile indexSnippetFile(const QString &code)
+{
+    static const QRegularExpression snippetRe(QStringLiteral(R"(^\s*//\s*@snippet\s+(.*?)\s*$)"));
+    Q_ASSERT(snippetRe.isValid());
+
+    SnippetFile result;
+    result.code = code;
+    QHash<QString, QString> openSnippets;
+    const auto lines = QStringView{code}.split(u'\n');
+    for (const auto &line : lines) {
+        QString label;
+        const auto match = snippetRe.match(line);
+        if (match.hasMatch()) {
+            label = match.captured(1);
+            if (!result.snippets.contains(label)) {
+                auto it = openSnippets.find(label);
+                if (it != openSnippets.end()) { // End of snippet reached
+                    result.snippets.insert(label, CodeSnipAbstract::fixSpaces(it.value()));
+                    openSnippets.erase(it);
+                } else {
+                    openSnippets.insert(label, QString());
+                }
+            }
+        }
+        for (auto it = openSnippets.begin(), end = openSnippets.end(); it != end; ++it) {
+            if (label.isEmpty() || it.key() != label)
+                it.value() += line.toString() + u'\n';
+        }
+    }
+    // Unterminated snippets extend to the end of the file
+    for (auto it = openSnippets.cbegin(), end = openSnippets.cend(); it != end; ++it)
+        result.snippets.insert(it.key(), CodeSnipAbstract::fixSpaces(it.value()));
+    return result;
+}
+
 template <class EnumType, Qt::CaseSensitivity cs = Qt::CaseInsensitive>
 struct EnumLookup
 {
@@ -2883,13 +2922,26 @@ bool TypeSystemParser::readFileSnippet(QXmlStreamAttributes *attributes, CodeSni
             + QDir::toNativeSeparators(fileName);
         return false;
     }
-    QFile codeFile(resolved);
-    if (!codeFile.open(QIODevice::Text | QIODevice::ReadOnly)) {
-        m_error = msgCannotOpenForReading(codeFile);
-        return false;
+    auto &snippetFiles = m_context->snippetFiles;
+    auto fileIt = snippetFiles.find(resolved);
+    if (fileIt == snippetFiles.end()) {
+        QFile codeFile(resolved);
+        if (!codeFile.open(QIODevice::Text | QIODevice::ReadOnly)) {
+            m_error = msgCannotOpenForReading(codeFile);
+            return false;
+        }
+        fileIt = snippetFiles.insert(resolved,
+                                     indexSnippetFile(QString::fromUtf8(codeFile.readAll())));
+    }
+    const SnippetFile &snippetFile = fileIt.value();
+    std::optional<QString> codeOptional;
+    if (snippetLabel.isEmpty()) {
+        codeOptional = snippetFile.code;
+    } else {
+        const auto snippetIt = snippetFile.snippets.constFind(snippetLabel);
+        if (snippetIt != snippetFile.snippets.cend())
+            codeOptional = snippetIt.value();
     }
-    const auto codeOptional = extractSnippet(QString::fromUtf8(codeFile.readAll()), snippetLabel);
-    codeFile.close();
     if (!codeOptional.has_value()) {
         m_error = msgCannotFindSnippet(resolved, snippetLabel);
         return false;
@@ -12,6 +12,7 @@
 #include "messages.h"
 #include "reporthandler.h"
 #include "fileout.h"
+#include "exception.h"
 #include "arraytypeentry.h"
 #include "enumtypeentry.h"
 #include "enumvaluetypeentry.h"
@@ -25,12 +26,17 @@
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
+#include <QtCore/QMutex>
 #include <QtCore/QRegularExpression>
+#include <QtCore/QThreadPool>
+
+#include <memory>
 
 using namespace Qt::StringLiterals;
 
 static const char ENABLE_PYSIDE_EXTENSIONS[] = "enable-pyside-extensions";
 static const char AVOID_PROTECTED_HACK[] = "avoid-protected-hack";
+static const char WRITE_JOBS[] = "write-jobs";
 
 struct Generator::GeneratorPrivate
 {
@@ -42,8 +48,52 @@ struct Generator::GeneratorPrivate
     bool m_hasPrivateClasses = false;
     bool m_usePySideExtensions = false;
     bool m_avoidProtectedHack = false;
+    int m_jobs = 1;
+
+    // Writing out the generated files (comparing against the existing
+    // contents and writing) is done in a thread pool when "--write-jobs" is
+    // given. The code itself is generated sequentially since the code model
+    // caches signatures and names lazily in mutable members of the meta
+    // functions, types and type entries, and the generators keep per-class
+    // state in members.
+    void writeFile(std::unique_ptr<FileOut> fileOut);
+    void waitForFiles();
+
+    QMutex m_writerErrorMutex;
+    QString m_writerError;
+    QThreadPool m_writerPool; // Destroyed (waiting for the threads) first
 };
 
+void Generator::GeneratorPrivate::writeFile(std::unique_ptr<FileOut> fileOut)
+{
+    // Diff output must not be interleaved
+    if (m_jobs <= 1 || FileOut::diff()) {
+        fileOut->done();
+        return;
+    }
+
+    std::shared_ptr<FileOut> sharedFileOut(fileOut.release());
+    m_writerPool.start([this, sharedFileOut]() {
+        try {
+            sharedFileOut->done();
+        } catch (const std::exception &e) {
+            QMutexLocker locker(&m_writerErrorMutex);
+            if (m_writerError.isEmpty())
+                m_writerError = QString::fromUtf8(e.what());
+        }
+    });
+}
+
+void Generator::GeneratorPrivate::waitForFiles()
+{
+    m_writerPool.waitForDone();
+    if (!m_writerError.isEmpty()) {
+        const QString error = m_writerError;
+        m_writerError.clear();
+        throw Exception(error);
+    }
+}
+
 Generator::Generator() : m_d(new GeneratorPrivate)
 {
 }
@@ -85,16 +135,28 @@ Generator::OptionDescriptions Generator::options() const
          u"Avoid the use of the '#define protected public' hack."_s},
         {QLatin1StringView(ENABLE_PYSIDE_EXTENSIONS),
          u"Enable PySide extensions, such as support for signal/slots,\n"
-          "use this if you are creating a binding for a Qt-based library."_s}
+          "use this if you are creating a binding for a Qt-based library."_s},
+        {QLatin1StringView(WRITE_JOBS) + u"=<n>"_s,
+         u"Number of threads used for writing the generated files\n"
+          "(the code is generated sequentially)"_s}
     };
 }
 
-bool Generator::handleOption(const QString & key, const QString & /* value */)
+bool Generator::handleOption(const QString & key, const QString & value)
 {
     if (key == QLatin1StringView(ENABLE_PYSIDE_EXTENSIONS))
         return ( m_d->m_usePySideExtensions = true);
     if (key == QLatin1StringView(AVOID_PROTECTED_HACK))
         return (m_d->m_avoidProtectedHack = true);
+    if (key == QLatin1StringView(WRITE_JOBS)) {
+        bool ok;
+        const int jobs = value.toInt(&ok);
+        if (!ok || jobs < 1)
+            return false;
+        m_d->m_jobs = jobs;
+        m_d->m_writerPool.setMaxThreadCount(jobs);
+        return true;
+    }
     return false;
 }
 
@@ -189,11 +251,11 @@ bool Generator::generateFileForContext(const GeneratorContext &context)
     QString filePath = outputDirectory() + u'/'
         + subDirectoryForPackage(typeEntry->targetLangPackage())
         + u'/' + fileName;
-    FileOut fileOut(filePath);
+    auto fileOut = std::make_unique<FileOut>(filePath);
 
-    generateClass(fileOut.stream, context);
+    generateClass(fileOut->stream, context);
 
-    fileOut.done();
+    m_d->writeFile(std::move(fileOut));
     return true;
 }
 
@@ -230,25 +292,32 @@ GeneratorContext Generator::contextForSmartPointer(const AbstractMetaClass *c,
 
 bool Generator::generate()
 {
-    for (auto cls : m_d->api.classes()) {
-        if (!generateFileForContext(contextForClass(cls)))
-            return false;
-        auto *te = cls->typeEntry();
-        if (shouldGenerate(te) && te->isPrivate())
-            m_d->m_hasPrivateClasses = true;
-    }
+    auto generateFiles = [this]() {
+        for (auto cls : m_d->api.classes()) {
+            if (!generateFileForContext(contextForClass(cls)))
+                return false;
+            auto *te = cls->typeEntry();
+            if (shouldGenerate(te) && te->isPrivate())
+                m_d->m_hasPrivateClasses = true;
+        }
 
-    for (const auto &smp: m_d->api.instantiatedSmartPointers()) {
-        const AbstractMetaClass *pointeeClass = nullptr;
-        const auto *instantiatedType = smp.type.instantiations().constFirst().typeEntry();
-        if (instantiatedType->isComplex()) // not a C++ primitive
-            pointeeClass = AbstractMetaClass::findClass(m_d->api.classes(), instantiatedType);
-        if (!generateFileForContext(contextForSmartPointer(smp.specialized, smp.type,
-                                                           pointeeClass))) {
-            return false;
+        for (const auto &smp: m_d->api.instantiatedSmartPointers()) {
+            const AbstractMetaClass *pointeeClass = nullptr;
+            const auto *instantiatedType = smp.type.instantiations().constFirst().typeEntry();
+            if (instantiatedType->isComplex()) // not a C++ primitive
+                pointeeClass = AbstractMetaClass::findClass(m_d->api.classes(), instantiatedType);
+            if (!generateFileForContext(contextForSmartPointer(smp.specialized, smp.type,
+                                                               pointeeClass))) {
+                return false;
+            }
         }
-    }
-    return finishGeneration();
+        return true;
+    };
+
+    // Wait for the files queued for writing on all paths
+    const bool result = generateFiles();
+    m_d->waitForFiles();
+    return result && finishGeneration();
 }
 
 bool Generator::shouldGenerate(const TypeEntry *typeEntry) const
@@ -38,6 +38,8 @@ static inline QString clangOptionsOption() { return QStringLiteral("clang-option
 static inline QString compilerOption() { return QStringLiteral("compiler"); }
 static inline QString compilerPathOption() { return QStringLiteral("compiler-path"); }
 static inline QString platformOption() { return QStringLiteral("platform"); }
+static inline QString clangCacheDirectoryOption() { return QStringLiteral("clang-cache-directory"); }
+static inline QString clangCacheBaseHeadersOption() { return QStringLiteral("clang-cache-base-headers"); }
 static inline QString apiVersionOption() { return QStringLiteral("api-version"); }
 static inline QString dropTypeEntriesOption() { return QStringLiteral("drop-type-entries"); }
 static inline QString languageLevelOption() { return QStringLiteral("language-level"); }
@@ -117,7 +119,7 @@ bool CommandLineArguments::addCommonOption(const QString &option,
 {
     bool result = true;
     if (option == compilerOption() || option == compilerPathOption()
-        || option == platformOption()) {
+        || option == platformOption() || option == clangCacheDirectoryOption()) {
         options.insert(option, value);
     } else if (option == clangOptionOption()) {
         options.insert(option, QStringList(value));
@@ -165,6 +167,8 @@ static QString projectFileKeywordToCommandLineOption(const QString &p)
         return typesystemPathOption();
     if (p == u"system-include-paths")
         return systemIncludePathOption();
+    if (p == u"clang-cache-base-header")
+        return clangCacheBaseHeadersOption();
     return {};
 }
 
@@ -261,7 +265,8 @@ static void getCommandLineArg(QString arg, int &argNum, CommandLineArguments &ar
         const QString value = arg.mid(split + 1).trimmed();
         if (args.addCommonOption(option, value)) {
         } else if (option == includePathOption() || option == frameworkIncludePathOption()
-                   || option == systemIncludePathOption() || option == typesystemPathOption()) {
+                   || option == systemIncludePathOption() || option == typesystemPathOption()
+                   || option == clangCacheBaseHeadersOption()) {
             // Add platform path-separator separated list value to path list
             args.addToOptionsPathList(option, value);
         } else {
@@ -357,6 +362,10 @@ void printUsage()
          u"Emulated platform (windows, darwin, unix)"_s},
         {compilerPathOption() + u"=<file>"_s,
          u"Path to the compiler for determining builtin include paths"_s},
+        {clangCacheDirectoryOption() + u"=<dir>"_s,
+         u"Directory for caching parsed translation units between runs"_s},
+        {clangCacheBaseHeadersOption() + u'=' + pathSyntax,
+         u"Headers of base modules to be precompiled into the cache directory"_s},
         {u"-F<path>"_s, {} },
         {u"framework-include-paths="_s + pathSyntax,
          u"Framework include paths used by the C++ parser"_s},
@@ -634,6 +643,18 @@ int shibokenMain(int argc, char *argv[])
         args.options.erase(ait);
     }
 
+    ait = args.options.find(clangCacheDirectoryOption());
+    if (ait != args.options.end()) {
+        clang::setTranslationUnitCacheDirectory(ait.value().toString());
+        args.options.erase(ait);
+    }
+
+    ait = args.options.find(clangCacheBaseHeadersOption());
+    if (ait != args.options.end()) {
+        clang::setTranslationUnitCacheBaseHeaders(ait.value().toStringList());
+        args.options.erase(ait);
+    }
+
     ait = args.options.find(platformOption());
     if (ait != args.options.end()) {
         const QString name = ait.value().toString();
@@ -335,6 +335,19 @@ std::optional<AbstractMetaType>
     return {};
 }
 
+// Return the index of a virtual method name in the table of the module, the
+// names are at 2 * index (unchanged) and 2 * index + 1 (snake_case).
+int CppGenerator::overrideNameIndex(const QString &name) const
+{
+    auto it = m_overrideNameIndexes.constFind(name);
+    if (it != m_overrideNameIndexes.cend())
+        return it.value();
+    const int index = int(m_overrideNames.size());
+    m_overrideNames.append(name);
+    m_overrideNameIndexes.insert(name, index);
+    return index;
+}
+
 void CppGenerator::clearTpFuncs()
 {
     m_tpFuncs = {
@@ -385,6 +398,40 @@ static QString buildPropertyString(const QPropertySpec &spec)
     return text;
 }
 
+// PYSIDE-1019: Convert a name as the snake_case feature does at runtime,
+// mirroring Shiboken::String::getSnakeCaseName() of libshiboken.
+static QString featureSnakeCaseName(const QString &name)
+{
+    if (name.size() < 3 || (name.startsWith(u"gl") && name.at(2).isUpper()))
+        return name;
+    QString result;
+    result.reserve(name.size() + 4);
+    for (qsizetype i = 0, size = name.size(); i < size; ++i) {
+        const QChar c = name.at(i);
+        if (c.isUpper()) {
+            if (i > 0 && name.at(i - 1).isUpper())
+                return name; // Give up at consecutive upper chars
+            result.append(u'_');
+            result.append(c.toLower());
+        } else {
+            result.append(c);
+        }
+    }
+    return result;
+}
+
+// The property string with snake_case names, which spells out the fields
+// left empty for their default values in buildPropertyString().
+static QString buildSnakeCasePropertyString(const QPropertySpec &spec)
+{
+    QString text = u'"' + featureSnakeCaseName(spec.name()) + u':'
+                   + featureSnakeCaseName(spec.read());
+    if (!spec.write().isEmpty())
+        text += u':' + featureSnakeCaseName(spec.write());
+    text += u'"';
+    return text;
+}
+
 static QString _plainName(const QString &s)
 {
     auto cutPos = s.lastIndexOf(u"::"_s);
@@ -598,9 +645,10 @@ static const char closeExternC[] =  "} // extern \"C\"\n\n";
 
 // Write methods definition
 static void writePyMethodDefs(TextStream &s, const QString &className,
-                              const QString &methodsDefinitions, bool generateCopy)
+                              const QString &methodsDefinitions, bool generateCopy,
+                              const char *arraySuffix = "_methods")
 {
-    s << "static PyMethodDef " << className << "_methods[] = {\n" << indent
+    s << "static PyMethodDef " << className << arraySuffix << "[] = {\n" << indent
         << methodsDefinitions << '\n';
     if (generateCopy) {
         s << "{\"__copy__\", reinterpret_cast<PyCFunction>(" << className << "___copy__)"
@@ -732,6 +780,7 @@ void CppGenerator::generateClass(TextStream &s, const GeneratorContext &classCon
     StringStream smd(TextStream::Language::Cpp);
     StringStream md(TextStream::Language::Cpp);
     StringStream signatureStream(TextStream::Language::Cpp);
+    PyMethodDefEntries methodDefEntries;
 
     s << openTargetExternC;
 
@@ -768,12 +817,16 @@ void CppGenerator::generateClass(TextStream &s, const GeneratorContext &classCon
                 smd << "static PyMethodDef " << methDefName << " = " << indent
                     << defEntries.constFirst() << outdent << ";\n\n";
             }
-            if (!m_tpFuncs.contains(rfunc->name()))
+            if (!m_tpFuncs.contains(rfunc->name())) {
                 md << defEntries;
+                methodDefEntries << defEntries;
+            }
         }
     }
-    for (const auto &pyMethodDef : typeEntry->addedPyMethodDefEntrys())
+    for (const auto &pyMethodDef : typeEntry->addedPyMethodDefEntrys()) {
         md << pyMethodDef << ",\n";
+        methodDefEntries << pyMethodDef;
+    }
     const QString methodsDefinitions = md.toString();
     const QString singleMethodDefinitions = smd.toString();
 
@@ -790,20 +843,25 @@ void CppGenerator::generateClass(TextStream &s, const GeneratorContext &classCon
     if (usePySideExtensions()) {
         // PYSIDE-1019: Write a compressed list of all properties `name:getter[:setter]`.
         //              Default values are suppressed.
-        QStringList sorter;
+        //              The snake_case list is parallel to it, spelling out all names.
+        QList<std::pair<QString, QString>> sorter;
         for (const auto &spec : metaClass->propertySpecs()) {
             if (!spec.generateGetSetDef())
-                sorter.append(buildPropertyString(spec));
+                sorter.append({buildPropertyString(spec), buildSnakeCasePropertyString(spec)});
         }
-        sorter.sort();
+        std::sort(sorter.begin(), sorter.end());
 
         s << '\n';
         s << "static const char *" << className << "_PropertyStrings[] = {\n" << indent;
         for (const auto &entry : qAsConst(sorter))
-            s << entry << ",\n";
+            s << entry.first << ",\n";
+        s << NULL_PTR << " // Sentinel\n"
+            << outdent << "};\n\n";
+        s << "static const char *" << className << "_SnakeCasePropertyStrings[] = {\n" << indent;
+        for (const auto &entry : qAsConst(sorter))
+            s << entry.second << ",\n";
         s << NULL_PTR << " // Sentinel\n"
             << outdent << "};\n\n";
-
     }
     // PYSIDE-1735: Write an EnumFlagInfo structure
     QStringList sorter;
@@ -820,6 +878,15 @@ void CppGenerator::generateClass(TextStream &s, const GeneratorContext &classCon
 
     // Write methods definition
     writePyMethodDefs(s, className, methodsDefinitions, typeEntry->isValue());
+    if (usePySideExtensions()) {
+        // PYSIDE-1019: The same methods with the names of the snake_case feature
+        for (auto &entry : methodDefEntries)
+            entry.name = featureSnakeCaseName(entry.name);
+        StringStream snakeCaseMd(TextStream::Language::Cpp);
+        snakeCaseMd << methodDefEntries;
+        writePyMethodDefs(s, className, snakeCaseMd.toString(), typeEntry->isValue(),
+                          "_methods_snake_case");
+    }
 
     // Write tp_s/getattro function
     const AttroCheck attroCheck = checkAttroFunctionNeeds(metaClass);
@@ -1108,6 +1175,7 @@ void CppGenerator::writeCacheResetNative(TextStream &s, const GeneratorContext &
     s << "void " << classContext.wrapperName()
         << "::resetPyMethodCache()\n{\n" << indent
         << "std::fill_n(m_PyMethodCache, sizeof(m_PyMethodCache) / sizeof(m_PyMethodCache[0]), false);\n"
+        << "m_PyMethodCacheVersion = Shiboken::BindingManager::overrideCacheVersion();\n"
         << outdent << "}\n\n";
 }
 
@@ -1384,10 +1452,12 @@ void CppGenerator::writeVirtualMethodNative(TextStream &s,
            << cacheIndex << R"( << "]=" << m_PyMethodCache[)" << cacheIndex
            << R"(] << '\n';)" << '\n';
     }
-    // PYSIDE-803: Build a boolean cache for unused overrides
+    // PYSIDE-803: Build a boolean cache for unused overrides. It is invalidated
+    // when methods of a type are changed, see BindingManager::overrideCacheVersion().
     const bool multi_line = func->isVoid() || !snips.isEmpty() || isAbstract;
-    s << "if (m_PyMethodCache[" << cacheIndex << "])" << (multi_line ? " {\n" : "\n")
-        << indent;
+    s << "if (m_PyMethodCache[" << cacheIndex << "]\n" << indent << indent
+        << "&& m_PyMethodCacheVersion == Shiboken::BindingManager::overrideCacheVersion())"
+        << (multi_line ? " {\n" : "\n") << outdent;
     writeVirtualMethodCppCall(s, func, funcName, snips, lastArg, retType,
                               returnStatement, false);
     s << outdent;
@@ -1401,26 +1471,18 @@ void CppGenerator::writeVirtualMethodNative(TextStream &s,
         << returnStatement << '\n' << outdent;
 
     // PYSIDE-1019: Add info about properties
-    int propFlag = 0;
-    if (func->isPropertyReader())
-        propFlag |= 1;
-    if (func->isPropertyWriter())
-        propFlag |= 2;
-    if (propFlag && func->isStatic())
-        propFlag |= 4;
-    QString propStr;
-    if (propFlag)
-        propStr = QString::number(propFlag) + u':';
-
-    s << "static PyObject *nameCache[2] = {};\n";
-    if (propFlag)
+    if (func->isPropertyReader() || func->isPropertyWriter())
         s << "// This method belongs to a property.\n";
-    s << "static const char *funcName = \"" << propStr << funcName << "\";\n"
-        << "Shiboken::AutoDecRef " << PYTHON_OVERRIDE_VAR
-        << "(Shiboken::BindingManager::instance().getOverride(this, nameCache, funcName));\n"
+    s << "Shiboken::AutoDecRef " << PYTHON_OVERRIDE_VAR
+        << "(Shiboken::BindingManager::instance().getOverride(this, "
+        << overrideNamesVariableName() << ", " << overrideNameIndex(funcName)
+        << " /* " << funcName << " */));\n"
         << "if (" << PYTHON_OVERRIDE_VAR << ".isNull()) {\n" << indent;
-    if (useOverrideCaching(func->ownerClass()))
-        s << "m_PyMethodCache[" << cacheIndex << "] = true;\n";
+    if (useOverrideCaching(func->ownerClass())) {
+        s << "if (m_PyMethodCacheVersion != Shiboken::BindingManager::overrideCacheVersion())\n"
+            << indent << "resetPyMethodCache();\n" << outdent
+            << "m_PyMethodCache[" << cacheIndex << "] = true;\n";
+    }
     writeVirtualMethodCppCall(s, func, funcName, snips, lastArg, retType,
                               returnStatement, true);
     s << outdent << "}\n\n"; //WS
@@ -2994,6 +3056,13 @@ qsizetype CppGenerator::writePythonToCppTypeConversion(TextStream &s,
 
     QString pythonToCppCall = pythonToCppFunc + u'(' + pyIn + u", &"_s
                               + cppOut + u')';
+    // Plain int/double/bool values are converted inline, the converter
+    // function is only called for other Python types.
+    if (arg.conversion == GeneratorArgument::Conversion::Default
+        && !fastPathPrimitiveType(type).isEmpty()) {
+        pythonToCppCall = u"Shiboken::Conversions::primitivePythonToCpp("_s + pythonToCppFunc
+                          + u", "_s + pyIn + u", &"_s + cppOut + u')';
+    }
     if (arg.conversion != GeneratorArgument::Conversion::ValueOrPointer) {
         // pythonToCppFunc may be 0 when less parameters are passed and
         // the defaultValue takes effect.
@@ -6023,9 +6092,12 @@ void CppGenerator::writeClassRegister(TextStream &s,
         << typePtr << "\n"
         << "InitSignatureStrings(pyType, " << initFunctionName << "_SignatureStrings);\n";
 
-    if (usePySideExtensions() && !classContext.forSmartPointer())
-        s << "SbkObjectType_SetPropertyStrings(pyType, "
-                    << chopType(pyTypeName) << "_PropertyStrings);\n";
+    if (usePySideExtensions() && !classContext.forSmartPointer()) {
+        const QString className = chopType(pyTypeName);
+        s << "SbkObjectType_SetPropertyStrings(pyType, " << className << "_PropertyStrings);\n"
+            << "SbkObjectType_SetSnakeCaseNames(pyType, " << className << "_methods_snake_case, "
+            << className << "_SnakeCasePropertyStrings);\n";
+    }
 
     if (!classContext.forSmartPointer())
         s << cpythonTypeNameExt(classTypeEntry) << " = pyType;\n\n";
@@ -6426,15 +6498,21 @@ void CppGenerator::writeSmartPointerGetattroFunction(TextStream &s,
 {
     Q_ASSERT(context.forSmartPointer());
     const AbstractMetaClass *metaClass = context.metaClass();
+    const auto *typeEntry = static_cast<const SmartPointerTypeEntry *>(metaClass->typeEntry());
+    const AbstractMetaClass *pointeeClass = context.pointeeClass();
+    // Value handles return the pointee by reference.
+    const bool forwardToPointee = pointeeClass != nullptr
+        && typeEntry->smartPointerType() != TypeSystem::SmartPointerType::ValueHandle;
+
     writeGetattroDefinition(s, metaClass);
-    s << "PyObject *tmp = PyObject_GenericGetAttr(self, name);\n"
-        << "if (tmp)\n" << indent << "return tmp;\n" << outdent
-        << "if (PyErr_ExceptionMatches(PyExc_AttributeError) == 0)\n"
-        << indent << "return nullptr;\n" << outdent
-        << "PyErr_Clear();\n";
+    s << "// Check the attributes of the smart pointer without raising an AttributeError\n"
+        << "// for each attribute of the pointee.\n"
+        << "if (Shiboken::Object::hasGenericAttribute(self, name))\n"
+        << indent << "return PyObject_GenericGetAttr(self, name);\n" << outdent;
 
-    if (boolCast.has_value()) {
+    if (boolCast.has_value() || forwardToPointee)
         writeSmartPointerCppSelfDefinition(s, context);
+    if (boolCast.has_value()) {
         s << "if (";
         writeNbBoolExpression(s, boolCast.value(), true /* invert */);
         s << ") {\n" << indent
@@ -6447,14 +6525,28 @@ return nullptr;
 
     // This generates the code which dispatches access to member functions
     // and fields from the smart pointer to its pointee.
-    s << smartPtrComment
-        << "if (auto *rawObj = PyObject_CallMethod(self, "
-        << SMART_POINTER_GETTER << ", 0)) {\n" << indent
-        << "if (auto *attribute = PyObject_GetAttr(rawObj, name))\n"
-        << indent << "tmp = attribute;\n" << outdent
-        << "Py_DECREF(rawObj);\n" << outdent
-        << "}\n"
-        << "if (!tmp) {\n" << indent
+    s << "PyObject *tmp = nullptr;\n";
+    if (forwardToPointee) {
+        // Take the pointee directly instead of calling the getter method,
+        // pointerToPython() reuses an existing wrapper of the pointee.
+        s << "// Try to find the 'name' attribute in the PyObject for the C++ object\n"
+            << "// held by the smart pointer.\n"
+            << "if (const auto *pointee = " << CPP_SELF_VAR << "->"
+            << typeEntry->getter() << "()) {\n" << indent
+            << "Shiboken::AutoDecRef rawObj(Shiboken::Conversions::pointerToPython("
+            << cpythonTypeNameExt(pointeeClass->typeEntry()) << ", pointee));\n"
+            << "if (!rawObj.isNull())\n" << indent
+            << "tmp = PyObject_GetAttr(rawObj.object(), name);\n" << outdent
+            << outdent << "}\n";
+    } else {
+        s << smartPtrComment
+            << "if (auto *rawObj = PyObject_CallMethod(self, "
+            << SMART_POINTER_GETTER << ", 0)) {\n" << indent
+            << "tmp = PyObject_GetAttr(rawObj, name);\n"
+            << "Py_DECREF(rawObj);\n" << outdent
+            << "}\n";
+    }
+    s << "if (!tmp) {\n" << indent
         << R"(PyTypeObject *tp = Py_TYPE(self);
 PyErr_Format(PyExc_AttributeError,
              "'%.50s' object has no attribute '%.400s'",
@@ -6657,7 +6749,9 @@ bool CppGenerator::finishGeneration()
        << "// Current module's PyObject pointer.\n"
        << "PyObject *" << pythonModuleObjectName() << " = nullptr;\n"
        << "// Current module's converter array.\n"
-       << "SbkConverter **" << convertersVariableName() << " = nullptr;\n";
+       << "SbkConverter **" << convertersVariableName() << " = nullptr;\n"
+       << "// Current module's names of virtual methods.\n"
+       << "PyObject **" << overrideNamesVariableName() << " = nullptr;\n";
 
     const CodeSnipList snips = moduleEntry->codeSnips();
 
@@ -6813,6 +6907,19 @@ bool CppGenerator::finishGeneration()
            << cppApiVariableName() << " = cppApi;\n\n";
     }
 
+    if (!m_overrideNames.isEmpty()) {
+        // PYSIDE-1019: The names in both spellings, see Shiboken::BindingManager::getOverride()
+        s << "// Create the interned names of the virtual methods of the current module.\n"
+            << "static const char *overrideNameStrings[] = {\n" << indent;
+        for (const auto &name : qAsConst(m_overrideNames))
+            s << '"' << name << "\", \"" << featureSnakeCaseName(name) << "\",\n";
+        s << outdent << "};\n"
+            << "static PyObject *overrideNames[" << (2 * m_overrideNames.size()) << "];\n"
+            << "for (int i = 0; i < " << (2 * m_overrideNames.size()) << "; ++i)\n" << indent
+            << "overrideNames[i] = Shiboken::String::createStaticString(overrideNameStrings[i]);\n"
+            << outdent << overrideNamesVariableName() << " = overrideNames;\n\n";
+    }
+
     s << "// Create an array of primitive type converters for the current module.\n"
         << "static SbkConverter *sbkConverters[SBK_" << moduleName()
         << "_CONVERTERS_IDX_COUNT" << "];\n"
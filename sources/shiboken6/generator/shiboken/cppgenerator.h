@@ -517,8 +517,13 @@ private:
         findSmartPointerInstantiation(const SmartPointerTypeEntry *pointer,
                                       const TypeEntry *pointee) const;
     void clearTpFuncs();
+    int overrideNameIndex(const QString &name) const;
 
     QHash<QString, QString> m_tpFuncs;
+    /// Python names of the virtual methods of the module, written as table of
+    /// interned strings for BindingManager::getOverride()
+    mutable QStringList m_overrideNames;
+    mutable QHash<QString, int> m_overrideNameIndexes;
 
     static const char *PYTHON_TO_CPPCONVERSION_STRUCT;
 };
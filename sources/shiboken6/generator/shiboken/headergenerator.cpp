@@ -198,6 +198,7 @@ void *qt_metacast(const char *_clname) override;
         s << "void resetPyMethodCache();\n"
             << outdent << "private:\n" << indent
             << "mutable bool m_PyMethodCache[" << maxOverrides << "];\n"
+            << "mutable unsigned m_PyMethodCacheVersion;\n"
             << outdent << "};\n\n";
         if (!innerHeaderGuard.isEmpty())
             s << "#  endif // SBK_" << innerHeaderGuard << "_H\n\n";
@@ -586,6 +587,8 @@ bool HeaderGenerator::finishGeneration()
     macrosStream << "extern PyObject *" << pythonModuleObjectName() << ";\n\n";
     macrosStream << "// This variable stores all type converters exported by this module.\n";
     macrosStream << "extern SbkConverter **" << convertersVariableName() << ";\n\n";
+    macrosStream << "// This variable stores the names of the virtual methods in both spellings.\n";
+    macrosStream << "extern PyObject **" << overrideNamesVariableName() << ";\n\n";
 
     // TODO-CONVERTER ------------------------------------------------------------------------------
     // Using a counter would not do, a fix must be made to APIExtractor's getTypeIndex().
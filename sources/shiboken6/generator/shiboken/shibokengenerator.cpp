@@ -922,6 +922,9 @@ QString ShibokenGenerator::cpythonIsConvertibleFunction(AbstractMetaType metaTyp
         result += u'(' + cpythonTypeNameExt(metaType) + u", "_s;
         return result;
     }
+    const QString fastPathType = fastPathPrimitiveType(metaType);
+    if (!fastPathType.isEmpty())
+        return result + u"primitivePythonToCppConversion<"_s + fastPathType + u">("_s;
     result += u"pythonToCppConversion("_s + converterObject(metaType);
     // Write out array sizes if known
     const AbstractMetaTypeList nestedArrayTypes = metaType.nestedArrayTypes();
@@ -936,6 +939,25 @@ QString ShibokenGenerator::cpythonIsConvertibleFunction(AbstractMetaType metaTyp
     return result;
 }
 
+QString ShibokenGenerator::fastPathPrimitiveType(const AbstractMetaType &type)
+{
+    static const QStringList fastPathTypes{u"int"_s, u"double"_s, u"float"_s, u"bool"_s};
+
+    const auto *typeEntry = type.typeEntry();
+    if (!typeEntry->isCppPrimitive() || typeEntry->isVoid() || type.indirections() != 0
+        || type.isArray() || !type.nestedArrayTypes().isEmpty()) {
+        return {};
+    }
+    const auto *pte = static_cast<const PrimitiveTypeEntry *>(typeEntry);
+    const auto *basicPte = pte->basicReferencedTypeEntry();
+    // Custom conversions from the typesystem must not be bypassed.
+    if (pte->customConversion() || basicPte->customConversion()
+        || !fastPathTypes.contains(basicPte->name())) {
+        return {};
+    }
+    return typeEntry->qualifiedCppName();
+}
+
 QString ShibokenGenerator::cpythonIsConvertibleFunction(const AbstractMetaArgument &metaArg)
 {
     return cpythonIsConvertibleFunction(metaArg.type());
@@ -2182,6 +2204,11 @@ QString ShibokenGenerator::convertersVariableName(const QString &moduleName)
     return result;
 }
 
+QString ShibokenGenerator::overrideNamesVariableName(const QString &moduleName)
+{
+    return u"Sbk"_s + moduleCppPrefix(moduleName) + u"OverrideNames"_s;
+}
+
 static QString processInstantiationsVariableName(const AbstractMetaType &type)
 {
     QString res = u'_' + _fixedCppTypeName(type.typeEntry()->qualifiedCppName()).toUpper();
@@ -223,6 +223,10 @@ protected:
     static QString cpythonIsConvertibleFunction(const TypeEntry *type);
     static QString cpythonIsConvertibleFunction(AbstractMetaType metaType);
     static QString cpythonIsConvertibleFunction(const AbstractMetaArgument &metaArg);
+    /// Returns the C++ type name of \p type if its conversion from Python can
+    /// use the inline fast path of libshiboken (plain int, double, float or
+    /// bool values), else an empty string.
+    static QString fastPathPrimitiveType(const AbstractMetaType &type);
 
     static QString cpythonToCppConversionFunction(const AbstractMetaClass *metaClass) ;
     static QString cpythonToCppConversionFunction(const AbstractMetaType &type,
@@ -282,6 +286,8 @@ protected:
     static QString cppApiVariableName(const QString &moduleName = QString());
     static QString pythonModuleObjectName(const QString &moduleName = QString());
     static QString convertersVariableName(const QString &moduleName = QString());
+    /// Returns the name of the interned names of the virtual methods of the module
+    static QString overrideNamesVariableName(const QString &moduleName = QString());
     /// Returns the type index variable name for a given class.
     static QString getTypeIndexVariableName(const AbstractMetaClass *metaClass);
     /// Returns the type index variable name for a given typedef for a template
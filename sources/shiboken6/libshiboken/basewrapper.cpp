@@ -7,15 +7,18 @@
 #include "helper.h"
 #include "sbkconverter.h"
 #include "sbkenum.h"
+#include "sbkenum_p.h"
 #include "sbkfeature_base.h"
 #include "sbkstring.h"
 #include "sbkstaticstrings.h"
 #include "sbkstaticstrings_p.h"
 #include "autodecref.h"
 #include "gilstate.h"
+#include "sbkstatistics_p.h"
 #include <string>
 #include <cstring>
 #include <cstddef>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <algorithm>
@@ -125,9 +128,26 @@ static PyGetSetDef SbkObjectType_tp_getset[] = {
     {nullptr, nullptr, nullptr, nullptr, nullptr}  // Sentinel
 };
 
+// PYSIDE-803: Assigning or deleting a method of a type may add or remove
+// overrides of virtual methods, invalidate the caches of getOverride().
+// Enums and flags change the enum compatibility names of the type and its
+// subclasses, assigning __bases__ those of any type.
+static int SbkObjectType_tp_setattro(PyObject *type, PyObject *name, PyObject *value)
+{
+    if (value == nullptr || PyCallable_Check(value))
+        Shiboken::BindingManager::invalidateOverrideCaches();
+    auto *pyType = reinterpret_cast<PyTypeObject *>(type);
+    if (PyObject_RichCompareBool(name, Shiboken::PyMagicName::bases(), Py_EQ) == 1)
+        Shiboken::Enum::invalidateShortcutDicts();
+    else if (Shiboken::Enum::affectsShortcutDicts(pyType, name, value))
+        Shiboken::Enum::invalidateShortcutDicts(pyType);
+    return PyType_Type.tp_setattro(type, name, value);
+}
+
 static PyType_Slot SbkObjectType_Type_slots[] = {
     {Py_tp_dealloc, reinterpret_cast<void *>(SbkObjectType_tp_dealloc)},
     {Py_tp_getattro, reinterpret_cast<void *>(mangled_type_getattro)},
+    {Py_tp_setattro, reinterpret_cast<void *>(SbkObjectType_tp_setattro)},
     {Py_tp_base, static_cast<void *>(&PyType_Type)},
     {Py_tp_alloc, reinterpret_cast<void *>(PyType_GenericAlloc)},
     {Py_tp_new, reinterpret_cast<void *>(SbkObjectType_tp_new)},
@@ -303,6 +323,8 @@ static void SbkDeallocWrapperCommon(PyObject *pyObj, bool canDelete)
     canDelete &= sbkObj->d->hasOwnership && sbkObj->d->validCppObject;
     if (canDelete) {
         if (sotp->delete_in_main_thread && Shiboken::currentThreadId() != Shiboken::mainThreadId()) {
+            Shiboken::Statistics::add(Shiboken::Statistics::DeferredDeletions);
+            SBK_TRACE1(deferred_deletion, sbkObj->d->cptr[0]);
             auto &bindingManager = Shiboken::BindingManager::instance();
             if (sotp->is_multicpp) {
                  Shiboken::DtorAccumulatorVisitor visitor(sbkObj);
@@ -404,6 +426,9 @@ void SbkObjectType_tp_dealloc(PyTypeObject *sbkType)
         sotp->original_name = nullptr;
         if (!Shiboken::ObjectType::isUserType(sbkType))
             Shiboken::Conversions::deleteConverter(sotp->converter);
+        Py_CLEAR(sotp->enumShortcutDict);
+        delete sotp->noOverrides;
+        sotp->noOverrides = nullptr;
         PepType_SOTP_delete(sbkType);
     }
 #ifndef Py_LIMITED_API
@@ -642,10 +667,11 @@ void _destroyParentInfo(SbkObject *obj, bool keepReference)
     Shiboken::ParentInfo *pInfo = obj->d->parentInfo;
     if (pInfo) {
         while(!pInfo->children.empty()) {
-            SbkObject *first = *pInfo->children.begin();
+            // Take the last child, removing it is then a plain pop_back()
+            SbkObject *child = pInfo->children.back();
             // Mark child as invalid
-            Shiboken::Object::invalidate(first);
-            Shiboken::Object::removeParent(first, false, keepReference);
+            Shiboken::Object::invalidate(child);
+            Shiboken::Object::removeParent(child, false, keepReference);
         }
         Shiboken::Object::removeParent(obj, false);
     }
@@ -738,6 +764,11 @@ void initShibokenSupport(PyObject *module)
 {
     Py_INCREF(SbkObject_TypeF());
     PyModule_AddObject(module, "Object", reinterpret_cast<PyObject *>(SbkObject_TypeF()));
+    if (auto *argumentTypeError = SbkArgumentTypeError_TypeF()) {
+        Py_INCREF(argumentTypeError);
+        PyModule_AddObject(module, "ArgumentTypeError",
+                           reinterpret_cast<PyObject *>(argumentTypeError));
+    }
 
     // PYSIDE-1735: When the initialization was moved into Shiboken import, this
     //              Py_INCREF became necessary. No idea why.
@@ -977,8 +1008,6 @@ bool hasSpecialCastFunction(PyTypeObject *sbkType)
 namespace Object
 {
 
-static void recursive_invalidate(SbkObject *self, std::set<SbkObject *>& seen);
-
 bool checkType(PyObject *pyObj)
 {
     return ObjectType::checkType(Py_TYPE(pyObj));
@@ -989,6 +1018,18 @@ bool isUserType(PyObject *pyObj)
     return ObjectType::isUserType(Py_TYPE(pyObj));
 }
 
+bool hasGenericAttribute(PyObject *pyObj, PyObject *name)
+{
+    if (_PepType_Lookup(Py_TYPE(pyObj), name) != nullptr)
+        return true;
+#ifdef PYPY_VERSION
+    PyObject *dict = SbkObject_GetDict_NoRef(pyObj);
+#else
+    PyObject *dict = reinterpret_cast<SbkObject *>(pyObj)->ob_dict;
+#endif
+    return dict != nullptr && PyDict_GetItem(dict, name) != nullptr;
+}
+
 Py_hash_t hash(PyObject *pyObj)
 {
     assert(Shiboken::Object::checkType(pyObj));
@@ -1135,62 +1176,153 @@ void releaseOwnership(PyObject *self)
     setSequenceOwnership(self, false);
 }
 
-/* Needed forward declarations */
-static void recursive_invalidate(PyObject *pyobj, std::set<SbkObject *>& seen);
-static void recursive_invalidate(SbkObject *self, std::set<SbkObject *> &seen);
+/// \internal Pending work of the iterative invalidation: an object whose
+/// children are being invalidated.
+struct InvalidationFrame
+{
+    SbkObject *self;
+    ChildrenList children; // Copy, the list can be changed during the process
+    std::size_t next;
+};
 
-void invalidate(PyObject *pyobj)
+/// \internal Iterative invalidation of objects, their children and the
+/// objects they refer to. The parent/child relation is a tree, but objects
+/// referred by keepReference() may form arbitrary graphs and several roots
+/// may share objects. The objects seen are then tracked in a set, which is
+/// only created when needed; until then, the objects are recorded in a
+/// plain vector.
+class Invalidation
 {
-    std::set<SbkObject *> seen;
-    recursive_invalidate(pyobj, seen);
-}
+public:
+    /// Requests tracking the objects seen in a set, for several roots.
+    void trackSeen();
+    void run(SbkObject *root);
 
-void invalidate(SbkObject *self)
+private:
+    bool visit(SbkObject *o);
+    void invalidateObject(SbkObject *self);
+
+    std::vector<InvalidationFrame> m_stack;
+    std::vector<SbkObject *> m_visited;
+    std::unique_ptr<std::set<SbkObject *>> m_seen;
+};
+
+void Invalidation::trackSeen()
 {
-    std::set<SbkObject *> seen;
-    recursive_invalidate(self, seen);
+    if (!m_seen) {
+        m_seen.reset(new std::set<SbkObject *>(m_visited.cbegin(), m_visited.cend()));
+        m_visited.clear();
+    }
 }
 
-static void recursive_invalidate(PyObject *pyobj, std::set<SbkObject *> &seen)
+// Returns false if \a o has been seen before.
+bool Invalidation::visit(SbkObject *o)
 {
-    const auto objs = splitPyObject(pyobj);
-    for (SbkObject *o : objs)
-        recursive_invalidate(o, seen);
+    if (m_seen)
+        return m_seen->insert(o).second;
+    m_visited.push_back(o);
+    return true;
 }
 
-static void recursive_invalidate(SbkObject *self, std::set<SbkObject *> &seen)
+static inline void invalidateWrapper(SbkObject *self)
 {
-    // Skip if this object not is a valid object or if it's already been seen
-    if (!self || reinterpret_cast<PyObject *>(self) == Py_None || seen.find(self) != seen.end())
-        return;
-    seen.insert(self);
-
     if (!self->d->containsCppWrapper) {
         self->d->validCppObject = false; // Mark object as invalid only if this is not a wrapper class
         BindingManager::instance().releaseWrapper(self);
     }
+}
 
-    // If it is a parent invalidate all children.
-    if (self->d->parentInfo) {
-        // Create a copy because this list can be changed during the process
-        ChildrenList copy = self->d->parentInfo->children;
+static inline bool hasChildren(const SbkObject *self)
+{
+    return self->d->parentInfo && !self->d->parentInfo->children.empty();
+}
+
+void Invalidation::invalidateObject(SbkObject *self)
+{
+    if (!self || reinterpret_cast<PyObject *>(self) == Py_None || !visit(self))
+        return;
+
+    invalidateWrapper(self);
 
-        for (SbkObject *child : copy) {
-            // invalidate the child
-            recursive_invalidate(child, seen);
+    if (hasChildren(self))
+        m_stack.push_back({self, self->d->parentInfo->children, 0});
+    else if (self->d->referredObjects)
+        m_stack.push_back({self, {}, 0});
+}
 
-            // if the parent not is a wrapper class, then remove children from him, because We do not know when this object will be destroyed
-            if (!self->d->validCppObject)
+void Invalidation::run(SbkObject *root)
+{
+    invalidateObject(root);
+    while (!m_stack.empty()) {
+        InvalidationFrame &frame = m_stack.back();
+        if (frame.next < frame.children.size()) {
+            // invalidate the child (may reallocate the stack)
+            SbkObject *child = frame.children[frame.next++];
+            invalidateObject(child);
+            continue;
+        }
+
+        SbkObject *self = frame.self;
+        const ChildrenList children = std::move(frame.children);
+        m_stack.pop_back();
+
+        // if the parent not is a wrapper class, then remove children from him, because We do not know when this object will be destroyed
+        if (!self->d->validCppObject) {
+            for (SbkObject *child : children)
                 removeParent(child, true, true);
         }
+
+        // If has ref to other objects invalidate all
+        if (self->d->referredObjects) {
+            trackSeen();
+            const RefCountMap &refCountMap = *(self->d->referredObjects);
+            for (auto it = refCountMap.begin(), end = refCountMap.end(); it != end; ++it) {
+                for (SbkObject *o : splitPyObject(it->second))
+                    invalidateObject(o);
+            }
+        }
     }
+}
 
-    // If has ref to other objects invalidate all
-    if (self->d->referredObjects) {
-        RefCountMap &refCountMap = *(self->d->referredObjects);
-        for (auto it = refCountMap.begin(), end = refCountMap.end(); it != end; ++it)
-            recursive_invalidate(it->second, seen);
+void invalidate(PyObject *pyobj)
+{
+    const auto objs = splitPyObject(pyobj);
+    Invalidation invalidation;
+    if (objs.size() > 1)
+        invalidation.trackSeen();
+    for (SbkObject *o : objs)
+        invalidation.run(o);
+}
+
+void invalidate(SbkObject *self)
+{
+    // Fast path for objects without children and references
+    if (self && reinterpret_cast<PyObject *>(self) != Py_None
+        && !hasChildren(self) && !self->d->referredObjects) {
+        invalidateWrapper(self);
+        return;
     }
+    Invalidation invalidation;
+    invalidation.run(self);
+}
+
+void detachWrappers(const void *const *cptrs, std::size_t count, bool invalidateWrappers)
+{
+    const auto wrappers = BindingManager::instance().retrieveWrappers(cptrs, count);
+    // Keep the wrappers alive while detaching, removing the parent may
+    // release the last reference.
+    for (SbkObject *wrapper : wrappers)
+        Py_INCREF(wrapper);
+    Invalidation invalidation;
+    if (invalidateWrappers && wrappers.size() > 1)
+        invalidation.trackSeen();
+    for (SbkObject *wrapper : wrappers) {
+        removeParent(wrapper);
+        if (invalidateWrappers)
+            invalidation.run(wrapper);
+    }
+    for (SbkObject *wrapper : wrappers)
+        Py_DECREF(wrapper);
 }
 
 void makeValid(SbkObject *self)
@@ -1350,6 +1482,8 @@ PyObject *newObject(PyTypeObject *instanceType,
 {
     // Try to find the exact type of cptr.
     if (!isExactType) {
+        Statistics::add(Statistics::TypeResolutions);
+        SBK_TRACE2(type_resolution, instanceType->tp_name, typeName);
         if (PyTypeObject *exactType = ObjectType::typeForTypeName(typeName))
             instanceType = exactType;
         else
@@ -1454,11 +1588,17 @@ void removeParent(SbkObject *child, bool giveOwnershipBack, bool keepReference)
 
     ChildrenList &oldBrothers = pInfo->parent->d->parentInfo->children;
     // Verify if this child is part of parent list
-    auto iChild = oldBrothers.find(child);
-    if (iChild == oldBrothers.end())
+    const std::size_t index = pInfo->indexInParent;
+    if (index >= oldBrothers.size() || oldBrothers[index] != child)
         return;
 
-    oldBrothers.erase(iChild);
+    // Move the last child into the freed slot
+    SbkObject *last = oldBrothers.back();
+    if (last != child) {
+        oldBrothers[index] = last;
+        last->d->parentInfo->indexInParent = index;
+    }
+    oldBrothers.pop_back();
 
     pInfo->parent = nullptr;
 
@@ -1530,7 +1670,9 @@ void setParent(PyObject *parent, PyObject *child)
             pInfo = child_->d->parentInfo = new ParentInfo;
 
         pInfo->parent = parent_;
-        parent_->d->parentInfo->children.insert(child_);
+        ChildrenList &children = parent_->d->parentInfo->children;
+        pInfo->indexInParent = children.size();
+        children.push_back(child_);
 
         // Add Parent ref
         Py_INCREF(child_);
@@ -1543,6 +1685,20 @@ void setParent(PyObject *parent, PyObject *child)
     Py_DECREF(child);
 }
 
+void setParentOfPointer(PyObject *parent, PyTypeObject *type, const void *cptr,
+                        ParentCheckFunction check)
+{
+    auto &bindingManager = BindingManager::instance();
+    if (SbkObject *child = bindingManager.retrieveWrapper(cptr)) {
+        setParent(parent, reinterpret_cast<PyObject *>(child));
+        return;
+    }
+    if (!parent || parent == Py_None)
+        bindingManager.removePendingParent(cptr);
+    else
+        bindingManager.addPendingParent(cptr, type, reinterpret_cast<SbkObject *>(parent), check);
+}
+
 void deallocData(SbkObject *self, bool cleanup)
 {
     // Make cleanup if this is not a wrapper otherwise this will be done on wrapper destructor
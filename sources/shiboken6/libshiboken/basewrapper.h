@@ -8,6 +8,7 @@
 #include "shibokenmacros.h"
 #include "sbktypefactory.h"
 
+#include <cstddef>
 #include <vector>
 #include <string>
 
@@ -56,6 +57,10 @@ typedef void (*ObjectDestructor)(void *);
 
 typedef void (*SubTypeInitHook)(PyTypeObject *, PyObject *, PyObject *);
 
+/// Checks whether the C++ object \p cptr is a child of \p parent when a
+/// wrapper is created for it, see Shiboken::Object::setParentOfPointer().
+typedef bool (*ParentCheckFunction)(PyObject *parent, const void *cptr);
+
 /// PYSIDE-1019: Set the function to select the current feature.
 /// Return value is the previous content.
 typedef void (*SelectableFeatureHook)(PyTypeObject *);
@@ -64,10 +69,25 @@ LIBSHIBOKEN_API SelectableFeatureHook initSelectableFeature(SelectableFeatureHoo
 /// PYSIDE-1626: Enforcing a context switch without further action.
 LIBSHIBOKEN_API void SbkObjectType_UpdateFeature(PyTypeObject *type);
 
+/// PYSIDE-1019: The select id of the feature set installed along the MRO of
+/// the type. It is stored together with a version of the feature sets which
+/// the caller changes when switching the dicts of any type; -1 is returned
+/// when it does not match.
+LIBSHIBOKEN_API int SbkObjectType_GetSelectId(PyTypeObject *type, unsigned version);
+LIBSHIBOKEN_API void SbkObjectType_SetSelectId(PyTypeObject *type, int selectId, unsigned version);
+
 /// PYSIDE-1019: Get access to PySide property strings.
 LIBSHIBOKEN_API const char **SbkObjectType_GetPropertyStrings(PyTypeObject *type);
 LIBSHIBOKEN_API void SbkObjectType_SetPropertyStrings(PyTypeObject *type, const char **strings);
 
+/// PYSIDE-1019: Get access to the precomputed snake_case names. The methods
+/// are a copy of tp_methods with the names converted, the property strings
+/// are parallel to the property strings with all fields spelled out.
+LIBSHIBOKEN_API PyMethodDef *SbkObjectType_GetSnakeCaseMethods(PyTypeObject *type);
+LIBSHIBOKEN_API const char **SbkObjectType_GetSnakeCasePropertyStrings(PyTypeObject *type);
+LIBSHIBOKEN_API void SbkObjectType_SetSnakeCaseNames(PyTypeObject *type, PyMethodDef *methods,
+                                                     const char **propertyStrings);
+
 /// PYSIDE-1735: Store the enumFlagInfo.
 LIBSHIBOKEN_API void SbkObjectType_SetEnumFlagInfo(PyTypeObject *type, const char **strings);
 
@@ -266,6 +286,13 @@ LIBSHIBOKEN_API bool checkType(PyObject *pyObj);
  */
 LIBSHIBOKEN_API bool isUserType(PyObject *pyObj);
 
+/**
+ *  Returns true if \p name is found in the type or the instance dictionary of
+ *  \p pyObj, that is, if PyObject_GenericGetAttr() would succeed. Unlike the
+ *  latter, it does not raise an AttributeError when the name is not found.
+ */
+LIBSHIBOKEN_API bool hasGenericAttribute(PyObject *pyObj, PyObject *name);
+
 /**
  *  Generic function used to make ObjectType hashable, the C++ pointer is used as hash value.
  */
@@ -390,6 +417,20 @@ LIBSHIBOKEN_API bool isValid(PyObject *pyObj, bool throwPyError);
 */
 LIBSHIBOKEN_API void setParent(PyObject *parent, PyObject *child);
 
+/**
+*   Set the parent of the C++ object \p cptr of type \p type to \p parent
+*   without creating a wrapper for it. If the object does not have a wrapper
+*   yet, the relation is recorded and applied when one is created for it
+*   and \p check confirms that it still holds. The object may have been
+*   deleted in C++ and another one created at the same address meanwhile.
+*   \param parent the parent object, if null, the child will have no parents.
+*   \param type the type of the child.
+*   \param cptr the C++ pointer of the child.
+*   \param check checks the relation before applying it.
+*/
+LIBSHIBOKEN_API void setParentOfPointer(PyObject *parent, PyTypeObject *type, const void *cptr,
+                                        ParentCheckFunction check);
+
 /**
 *   Remove this child from their parent, if any.
 *   \param child the child.
@@ -406,6 +447,18 @@ LIBSHIBOKEN_API void invalidate(SbkObject *self);
  **/
 LIBSHIBOKEN_API void invalidate(PyObject *pyobj);
 
+/**
+ *   Detach the wrappers of C++ objects which a container is about to delete,
+ *   for example in QGraphicsScene::clear(): Remove them from their parents and
+ *   optionally invalidate them. The wrappers are looked up under one lock of
+ *   the wrapper map and invalidated in one pass.
+ *   \param cptrs the C++ objects, objects without a wrapper are skipped.
+ *   \param count the number of C++ objects.
+ *   \param invalidate whether to invalidate the wrappers.
+ */
+LIBSHIBOKEN_API void detachWrappers(const void *const *cptrs, std::size_t count,
+                                    bool invalidate = true);
+
 /**
  * Make the object valid again
  */
@@ -8,6 +8,8 @@
 #include "basewrapper.h"
 
 #include <unordered_map>
+#include <unordered_set>
+#include <cstddef>
 #include <set>
 #include <string>
 #include <vector>
@@ -24,18 +26,22 @@ namespace Shiboken
     */
 using RefCountMap = std::unordered_multimap<std::string, PyObject *> ;
 
-/// Linked list of SbkBaseWrapper pointers
-using ChildrenList = std::set<SbkObject *>;
+/// Flat list of SbkBaseWrapper pointers. The order is not significant,
+/// children are removed by swapping with the last element.
+using ChildrenList = std::vector<SbkObject *>;
 
 /// Structure used to store information about object parent and children.
 struct ParentInfo
 {
     /// Default ctor.
-    ParentInfo() : parent(nullptr), hasWrapperRef(false) {}
+    ParentInfo() : parent(nullptr), indexInParent(0), hasWrapperRef(false) {}
     /// Pointer to parent object.
     SbkObject *parent;
     /// List of object children.
     ChildrenList children;
+    /// Position of this object in the children list of \p parent (valid
+    /// when \p parent is set), allows for O(1) removal.
+    std::size_t indexInParent;
     /// has internal ref
     bool hasWrapperRef;
 };
@@ -104,9 +110,28 @@ struct SbkObjectTypePrivate
     DeleteUserDataFunc d_func;
     void (*subtype_init)(PyTypeObject *, PyObject *, PyObject *);
     const char **propertyStrings;
+    /// PYSIDE-1019: The methods and property strings with snake_case names
+    /// written by the generator, parallel to tp_methods and propertyStrings
+    PyMethodDef *snakeCaseMethods;
+    const char **snakeCasePropertyStrings;
     const char **enumFlagInfo;
     PyObject *enumFlagsDict;
     PyObject *enumTypeDict;
+    /// Flat lookup of the enum compatibility names along the MRO, see mangled_type_getattro()
+    PyObject *enumShortcutDict;
+    unsigned enumShortcutDictVersion;
+    /// Sum of the enumShortcutTypeVersion along the MRO when enumShortcutDict was built
+    unsigned enumShortcutDictMroVersion;
+    /// Incremented when enum names of this type change, see Enum::invalidateShortcutDicts()
+    unsigned enumShortcutTypeVersion;
+    /// Virtual methods (keyed by their name caches) known not to be overridden
+    /// by this type, see BindingManager::getOverride()
+    std::unordered_set<const void *> *noOverrides;
+    unsigned noOverridesVersion;
+    int noOverridesSelectId;
+    /// The feature set installed along the MRO, see SbkObjectType_GetSelectId()
+    int featureSelectId;
+    unsigned featureSelectVersion;
 
     /// True if this type holds two or more C++ instances, e.g.: a Python class which inherits from two C++ classes.
     unsigned int is_multicpp : 1;
@@ -115,6 +140,9 @@ struct SbkObjectTypePrivate
     /// Tells is the type is a value type or an object-type, see BEHAVIOUR_ *constants.
     unsigned int type_behaviour : 2;
     unsigned int delete_in_main_thread : 1;
+    /// True if noOverrides cannot be used since classes in the MRO are not
+    /// Shiboken types, see BindingManager::getOverride()
+    unsigned int noOverridesUnsupported : 1;
 };
 
 
@@ -10,11 +10,13 @@
 #include "sbkstaticstrings.h"
 #include "sbkfeature_base.h"
 #include "debugfreehook.h"
+#include "sbkstatistics_p.h"
 
 #include <cstddef>
 #include <fstream>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace Shiboken
 {
@@ -102,8 +104,19 @@ static void showWrapperMap(const WrapperMap &wrapperMap)
 }
 #endif
 
+// Parent relation of a C++ object without wrapper, see Object::setParentOfPointer()
+struct PendingParent
+{
+    SbkObject *parent;
+    PyTypeObject *type;
+    ParentCheckFunction check;
+};
+
 struct BindingManager::BindingManagerPrivate {
     using DestructorEntries = std::vector<DestructorEntry>;
+    using PendingParentMap = std::unordered_map<const void *, PendingParent>;
+    using PendingChildrenMap = std::unordered_map<const SbkObject *,
+                                                  std::unordered_set<const void *>>;
 
     WrapperMap wrapperMapper;
     // Guard wrapperMapper mainly for QML which calls into the generated
@@ -113,11 +126,18 @@ struct BindingManager::BindingManagerPrivate {
     std::recursive_mutex wrapperMapLock;
     Graph classHierarchy;
     DestructorEntries deleteInMainThread;
+    // Parent relations to be applied when the C++ objects get a wrapper and
+    // the reverse index used to drop them when the parent goes away, both
+    // guarded by wrapperMapLock.
+    PendingParentMap pendingParents;
+    PendingChildrenMap pendingChildren;
     bool destroying;
 
     BindingManagerPrivate() : destroying(false) {}
     bool releaseWrapper(void *cptr, SbkObject *wrapper);
     void assignWrapper(SbkObject *wrapper, const void *cptr);
+    bool takePendingParent(const void *cptr, PendingParent *pending);
+    void releasePendingChildren(const SbkObject *parent);
 
 };
 
@@ -144,6 +164,42 @@ void BindingManager::BindingManagerPrivate::assignWrapper(SbkObject *wrapper, co
         wrapperMapper.insert(std::make_pair(cptr, wrapper));
 }
 
+bool BindingManager::BindingManagerPrivate::takePendingParent(const void *cptr,
+                                                             PendingParent *pending)
+{
+    auto iter = pendingParents.find(cptr);
+    if (iter == pendingParents.end())
+        return false;
+    if (pending != nullptr)
+        *pending = iter->second;
+    auto childrenIt = pendingChildren.find(iter->second.parent);
+    childrenIt->second.erase(cptr);
+    if (childrenIt->second.empty())
+        pendingChildren.erase(childrenIt);
+    pendingParents.erase(iter);
+    return true;
+}
+
+void BindingManager::BindingManagerPrivate::releasePendingChildren(const SbkObject *parent)
+{
+    std::lock_guard<std::recursive_mutex> guard(wrapperMapLock);
+    if (pendingChildren.empty())
+        return;
+    auto iter = pendingChildren.find(parent);
+    if (iter == pendingChildren.end())
+        return;
+    for (const void *cptr : iter->second)
+        pendingParents.erase(cptr);
+    pendingChildren.erase(iter);
+}
+
+static inline int *multipleInheritanceOffsets(SbkObjectTypePrivate *d, void *cptr)
+{
+    if (d->mi_init && !d->mi_offsets)
+        d->mi_offsets = d->mi_init(cptr);
+    return d->mi_offsets;
+}
+
 BindingManager::BindingManager()
 {
     m_d = new BindingManager::BindingManagerPrivate;
@@ -193,21 +249,72 @@ void BindingManager::registerWrapper(SbkObject *pyObj, void *cptr)
     if (!d)
         return;
 
-    if (d->mi_init && !d->mi_offsets)
-        d->mi_offsets = d->mi_init(cptr);
-    m_d->assignWrapper(pyObj, cptr);
-    if (d->mi_offsets) {
-        int *offset = d->mi_offsets;
-        while (*offset != -1) {
-            if (*offset > 0)
-                m_d->assignWrapper(pyObj, reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(cptr) + *offset));
-            offset++;
+    // A parent relation may have been recorded for any of the base class
+    // pointers. It is checked after unlocking, since the object at the
+    // address may be another one than the one it was recorded for.
+    PendingParent parent{nullptr, nullptr, nullptr};
+    const void *parentAddress = nullptr;
+    {
+        std::lock_guard<std::recursive_mutex> guard(m_d->wrapperMapLock);
+        const bool hasPendingParents = !m_d->pendingParents.empty();
+        PendingParent pending;
+        auto takePendingParent = [&](const void *address) {
+            if (m_d->takePendingParent(address, &pending) && parent.parent == nullptr
+                && PyType_IsSubtype(instanceType, pending.type)) {
+                parent = pending;
+                parentAddress = address;
+            }
+        };
+        int *offset = multipleInheritanceOffsets(d, cptr);
+        m_d->assignWrapper(pyObj, cptr);
+        if (hasPendingParents)
+            takePendingParent(cptr);
+        if (offset) {
+            while (*offset != -1) {
+                if (*offset > 0) {
+                    auto *address = reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(cptr) + *offset);
+                    m_d->assignWrapper(pyObj, address);
+                    if (hasPendingParents)
+                        takePendingParent(address);
+                }
+                offset++;
+            }
+        }
+    }
+
+    if (parent.parent != nullptr) {
+        auto *obParent = reinterpret_cast<PyObject *>(parent.parent);
+        if (parent.check(obParent, parentAddress))
+            Object::setParent(obParent, reinterpret_cast<PyObject *>(pyObj));
+    }
+}
+
+void BindingManager::addPendingParent(const void *cptr, PyTypeObject *type, SbkObject *parent,
+                                      ParentCheckFunction check)
+{
+    std::lock_guard<std::recursive_mutex> guard(m_d->wrapperMapLock);
+    auto iter = m_d->pendingParents.find(cptr);
+    if (iter != m_d->pendingParents.end()) {
+        if (iter->second.parent == parent) {
+            iter->second.type = type;
+            iter->second.check = check;
+            return;
         }
+        m_d->takePendingParent(cptr, nullptr);
     }
+    m_d->pendingParents.insert({cptr, PendingParent{parent, type, check}});
+    m_d->pendingChildren[parent].insert(cptr);
+}
+
+void BindingManager::removePendingParent(const void *cptr)
+{
+    std::lock_guard<std::recursive_mutex> guard(m_d->wrapperMapLock);
+    m_d->takePendingParent(cptr, nullptr);
 }
 
 void BindingManager::releaseWrapper(SbkObject *sbkObj)
 {
+    m_d->releasePendingChildren(sbkObj);
     auto *sbkType = Py_TYPE(sbkObj);
     auto *d = PepType_SOTP(sbkType);
     int numBases = ((d && d->is_multicpp) ? getNumberOfCppBaseClasses(Py_TYPE(sbkObj)) : 1);
@@ -242,18 +349,43 @@ void BindingManager::addToDeletionInMainThread(const DestructorEntry &e)
 
 SbkObject *BindingManager::retrieveWrapper(const void *cptr)
 {
+    Statistics::add(Statistics::WrapperMapLookups);
+#ifdef SHIBOKEN_STATISTICS
+    std::unique_lock<std::recursive_mutex> guard(m_d->wrapperMapLock, std::try_to_lock);
+    if (!guard.owns_lock()) {
+        Statistics::add(Statistics::WrapperMapLockContentions);
+        guard.lock();
+    }
+#else
     std::lock_guard<std::recursive_mutex> guard(m_d->wrapperMapLock);
+#endif
     auto iter = m_d->wrapperMapper.find(cptr);
     if (iter == m_d->wrapperMapper.end())
         return nullptr;
     return iter->second;
 }
 
-PyObject *BindingManager::getOverride(const void *cptr,
-                                      PyObject *nameCache[],
-                                      const char *methodName)
+std::vector<SbkObject *> BindingManager::retrieveWrappers(const void *const *cptrs,
+                                                         std::size_t count)
+{
+    std::vector<SbkObject *> result;
+    result.reserve(count);
+    Statistics::add(Statistics::WrapperMapLookups, count);
+    std::lock_guard<std::recursive_mutex> guard(m_d->wrapperMapLock);
+    const auto end = m_d->wrapperMapper.cend();
+    for (std::size_t i = 0; i < count; ++i) {
+        auto iter = m_d->wrapperMapper.find(cptrs[i]);
+        if (iter != end)
+            result.push_back(iter->second);
+    }
+    return result;
+}
+
+// Returns the wrapper of \p cptr when its virtual methods may be overridden,
+// that is, it exists and is not being destroyed.
+static SbkObject *overrideWrapper(BindingManager &bindingManager, const void *cptr)
 {
-    SbkObject *wrapper = retrieveWrapper(cptr);
+    SbkObject *wrapper = bindingManager.retrieveWrapper(cptr);
     // The refcount can be 0 if the object is dieing and someone called
     // a virtual method from the destructor
     if (!wrapper || reinterpret_cast<const PyObject *>(wrapper)->ob_refcnt == 0)
@@ -261,6 +393,21 @@ PyObject *BindingManager::getOverride(const void *cptr,
 
     // PYSIDE-1626: Touch the type to initiate switching early.
     SbkObjectType_UpdateFeature(Py_TYPE(wrapper));
+    return wrapper;
+}
+
+static PyObject *findOverride(SbkObject *wrapper, int flag, PyObject *pyMethodName,
+                              const void *cacheKey);
+
+PyObject *BindingManager::getOverride(const void *cptr,
+                                      PyObject *nameCache[],
+                                      const char *methodName)
+{
+    Statistics::add(Statistics::OverrideLookups);
+    SBK_TRACE2(override_lookup, cptr, methodName);
+    SbkObject *wrapper = overrideWrapper(*this, cptr);
+    if (wrapper == nullptr)
+        return nullptr;
 
     int flag = currentSelectId(Py_TYPE(wrapper));
     int propFlag = isdigit(methodName[0]) ? methodName[0] - '0' : 0;
@@ -272,16 +419,68 @@ PyObject *BindingManager::getOverride(const void *cptr,
         pyMethodName = Shiboken::String::getSnakeCaseName(methodName, is_snake);
         nameCache[is_snake] = pyMethodName;
     }
+    return findOverride(wrapper, flag, pyMethodName, nameCache);
+}
 
+PyObject *BindingManager::getOverride(const void *cptr, PyObject *const names[], int nameIndex)
+{
+    Statistics::add(Statistics::OverrideLookups);
+    SbkObject *wrapper = overrideWrapper(*this, cptr);
+    if (wrapper == nullptr)
+        return nullptr;
+
+    const int flag = currentSelectId(Py_TYPE(wrapper));
+    PyObject *const *nameEntry = names + 2 * nameIndex;
+    PyObject *pyMethodName = nameEntry[flag & 0x01]; // borrowed
+    SBK_TRACE2(override_lookup_index, cptr, nameIndex);
+    return findOverride(wrapper, flag, pyMethodName, nameEntry);
+}
+
+// The "not overridden" set of a type is invalidated by assignments to
+// Shiboken types (SbkObjectType_tp_setattro()) only. Assigning a method to
+// another class in the MRO like a plain Python mixin goes through
+// type.__setattr__, so types having such classes cannot use it.
+static bool canCacheNoOverrides(PyTypeObject *type)
+{
+    PyObject *mro = type->tp_mro;
+    const Py_ssize_t size = PyTuple_GET_SIZE(mro);
+    for (Py_ssize_t idx = 0; idx < size - 1; ++idx) { // The last one is object
+        if (!PyObject_TypeCheck(PyTuple_GET_ITEM(mro, idx), SbkObjectType_TypeF()))
+            return false;
+    }
+    return true;
+}
+
+static PyObject *findOverride(SbkObject *wrapper, int flag, PyObject *pyMethodName,
+                              const void *cacheKey)
+{
     auto *obWrapper = reinterpret_cast<PyObject *>(wrapper);
     auto *wrapper_dict = SbkObject_GetDict_NoRef(obWrapper);
     if (PyObject *method = PyDict_GetItem(wrapper_dict, pyMethodName)) {
         // Note: This special case was implemented for duck-punching, which happens
         // in the instance dict. It does not work with properties.
+        Statistics::add(Statistics::OverrideHits);
         Py_INCREF(method);
         return method;
     }
 
+    // PYSIDE-803: The type remembers the methods it does not override, so
+    // that new instances do not need to search the MRO again.
+    auto *sotp = PepType_SOTP(Py_TYPE(wrapper));
+    if (sotp->noOverrides != nullptr) {
+        if (sotp->noOverridesVersion != BindingManager::overrideCacheVersion()
+            || sotp->noOverridesSelectId != flag) {
+            sotp->noOverrides->clear();
+            sotp->noOverridesVersion = BindingManager::overrideCacheVersion();
+            sotp->noOverridesSelectId = flag;
+            // Assigning __bases__ also bumps the version.
+            sotp->noOverridesUnsupported = canCacheNoOverrides(Py_TYPE(wrapper)) ? 0 : 1;
+        } else if (sotp->noOverrides->count(cacheKey) != 0) {
+            Statistics::add(Statistics::OverrideTypeCacheHits);
+            return nullptr;
+        }
+    }
+
     PyObject *method = PyObject_GetAttr(reinterpret_cast<PyObject *>(wrapper), pyMethodName);
 
     PyObject *function = nullptr;
@@ -329,17 +528,43 @@ PyObject *BindingManager::getOverride(const void *cptr,
             auto *parent = reinterpret_cast<PyTypeObject *>(PyTuple_GET_ITEM(mro, idx));
             if (parent->tp_dict) {
                 defaultMethod = PyDict_GetItem(parent->tp_dict, pyMethodName);
-                if (defaultMethod && function != defaultMethod)
+                if (defaultMethod && function != defaultMethod) {
+                    Statistics::add(Statistics::OverrideHits);
                     return method;
+                }
             }
         }
 
         Py_DECREF(method);
     }
 
+    if (!PyErr_Occurred() && sotp->noOverridesUnsupported == 0) {
+        if (sotp->noOverrides == nullptr) {
+            if (!canCacheNoOverrides(Py_TYPE(wrapper))) {
+                sotp->noOverridesUnsupported = 1;
+                return nullptr;
+            }
+            sotp->noOverrides = new std::unordered_set<const void *>;
+            sotp->noOverridesVersion = BindingManager::overrideCacheVersion();
+            sotp->noOverridesSelectId = flag;
+        }
+        sotp->noOverrides->insert(cacheKey);
+    }
     return nullptr;
 }
 
+static unsigned overrideCacheVersionCounter = 1;
+
+unsigned BindingManager::overrideCacheVersion()
+{
+    return overrideCacheVersionCounter;
+}
+
+void BindingManager::invalidateOverrideCaches()
+{
+    ++overrideCacheVersionCounter;
+}
+
 void BindingManager::addClassInheritance(PyTypeObject *parent, PyTypeObject *child)
 {
     m_d->classHierarchy.addEdge(parent, child);
@@ -5,7 +5,10 @@
 #define BINDINGMANAGER_H
 
 #include "sbkpython.h"
+#include "basewrapper.h"
+#include <cstddef>
 #include <set>
+#include <vector>
 #include "shibokenmacros.h"
 
 struct SbkObject;
@@ -29,14 +32,36 @@ public:
 
     bool hasWrapper(const void *cptr);
 
+    /// Registers the wrapper \p pyObj of \p cptr. A parent recorded for
+    /// \p cptr by addPendingParent() is applied if it still holds.
     void registerWrapper(SbkObject *pyObj, void *cptr);
     void releaseWrapper(SbkObject *wrapper);
 
+    /// Records \p parent as parent of the C++ object \p cptr of type \p type
+    /// which does not have a wrapper, see Object::setParentOfPointer().
+    /// The relation is dropped when the wrapper of \p parent is released.
+    void addPendingParent(const void *cptr, PyTypeObject *type, SbkObject *parent,
+                          ParentCheckFunction check);
+    void removePendingParent(const void *cptr);
+
     void runDeletionInMainThread();
     void addToDeletionInMainThread(const DestructorEntry &);
 
     SbkObject *retrieveWrapper(const void *cptr);
+    /// Retrieves the wrappers of \p count C++ objects under one lock of the
+    /// wrapper map. Objects without a wrapper are skipped.
+    std::vector<SbkObject *> retrieveWrappers(const void *const *cptrs, std::size_t count);
     PyObject *getOverride(const void *cptr, PyObject *nameCache[], const char *methodName);
+    /// Returns the Python override of a virtual method whose name is at
+    /// \p nameIndex of the interned names \p names of the module. The entry
+    /// consists of the name as is and its snake_case version.
+    PyObject *getOverride(const void *cptr, PyObject *const names[], int nameIndex);
+
+    /// Returns the version of the caches of virtual methods which are not
+    /// overridden in Python. It changes when methods of a type are assigned
+    /// or deleted, which invalidates the caches of the types and wrappers.
+    static unsigned overrideCacheVersion();
+    static void invalidateOverrideCaches();
 
     void addClassInheritance(PyTypeObject *parent, PyTypeObject *child);
     /**
@@ -14,6 +14,10 @@ binary, we cannot use the zipimport module from Python.
 But a similar solution is possible that allows for normal imports.
 
 See signature_bootstrap.py for details.
+
+When .pyc files can be used, the modules are also written as marshalled
+code objects into 'signature_code_inc.h'. They are imported directly from
+the binary, without decoding, unzipping and compiling at runtime.
 """
 
 import sys
@@ -22,6 +26,7 @@ import subprocess
 import textwrap
 import tempfile
 import argparse
+import importlib.util
 import marshal
 import traceback
 from pathlib import Path
@@ -52,6 +57,10 @@ def create_zipfile(use_pyc, quiet):
     """
     zip_name = "signature.zip"
     inc_name = "signature_inc.h"
+    code_inc_name = "signature_code_inc.h"
+    boot_inc_name = "signature_bootstrap_inc.h"
+    # The generated files live in work_dir, too, but must not be zipped.
+    generated = (zip_name, inc_name, code_inc_name, boot_inc_name)
     flag = '-b'
     os.chdir(work_dir)
 
@@ -74,12 +83,16 @@ def create_zipfile(use_pyc, quiet):
     if embed_dir != work_dir:
         utils.copyfile(embed_dir / "signature_bootstrap.py", work_dir)
 
+    # Precompiled code objects, loaded without unpacking the zip file.
+    with open(code_inc_name, "w") as inc:
+        _embed_code(work_dir / "shibokensupport", inc)
+
     if not use_pyc:
         pass   # We cannot compile, unless we have folders per Python version
     else:
-        files = ' '.join(fn for fn in os.listdir('.'))
+        files = ' '.join(fn for fn in os.listdir('.') if fn not in generated)
         runpy(f'-m compileall -q {flag} {files}')
-    files = ' '.join(fn for fn in os.listdir('.') if not fn == zip_name)
+    files = ' '.join(fn for fn in os.listdir('.') if fn not in generated)
     runpy(f'-m zipfile -c {zip_name} {files}')
     tmp = tempfile.TemporaryFile(mode="w+")
     runpy(f'-m base64 {zip_name}', stdout=tmp)
@@ -91,7 +104,7 @@ def create_zipfile(use_pyc, quiet):
 
     # also generate a simple embeddable .pyc file for signature_bootstrap.pyc
     boot_name = "signature_bootstrap.py" if not use_pyc else "signature_bootstrap.pyc"
-    with open(boot_name, "rb") as ldr, open("signature_bootstrap_inc.h", "w") as inc:
+    with open(boot_name, "rb") as ldr, open(boot_inc_name, "w") as inc:
         _embed_bytefile(ldr, inc, not use_pyc)
     os.chdir(cur_dir)
     if quiet:
@@ -199,6 +212,53 @@ def _embed_bytefile(fin, fout, is_text):
     print("/* End Of File */", file=fout)
 
 
+def _embed_code(package_dir, fout):
+    """
+    Compile the Python files of the support package and write the marshalled
+    code objects as a table of byte arrays for embedding in a C++ source file.
+    The table is loaded directly from the read-only data of the library,
+    see signature_globals.cpp . The table is written also when the zip file
+    contains source code (limited API, cross builds); it is only used when the
+    magic number matches the running interpreter.
+    """
+    version = ".".join(map(str, sys.version_info[:3]))
+    magic = int.from_bytes(importlib.util.MAGIC_NUMBER, "little")
+    print(textwrap.dedent(f"""
+        /*
+         * These are the marshalled code objects of all Python files in the directory
+         *         "shiboken6/shibokenmodule/files.dir/shibokensupport"
+         * compiled by Python {version}. They are only used when the magic number
+         * matches the running interpreter, otherwise the ZIP archive is loaded.
+         */
+         """).strip(), file=fout)
+    print(file=fout)
+    print(f"static const long PySide_SignatureCodeMagic = {magic:#x};", file=fout)
+    entries = []
+    for idx, path in enumerate(sorted(package_dir.rglob("*.py"))):
+        filename = path.relative_to(package_dir.parent).as_posix()
+        modname = filename[:-3].replace("/", ".")
+        if modname.endswith(".__init__"):
+            modname = modname[:-9]
+        code = compile(path.read_text(encoding="utf-8"), filename, "exec",
+                       dont_inherit=True)
+        binstr = marshal.dumps(code)
+        array = f"PySide_SignatureCode_{idx}"
+        entries.append((modname, filename, array))
+        print(file=fout)
+        print(f"/* {filename} */", file=fout)
+        print(f"static const unsigned char {array}[] = {{", file=fout)
+        for i in range(0, len(binstr), 16):
+            print("".join(f"{c:#4}," for c in binstr[i : i + 16]), file=fout)
+        print("};", file=fout)
+    print(file=fout)
+    print("static const PySideEmbeddedCode PySide_SignatureCode[] = {", file=fout)
+    for modname, filename, array in entries:
+        print(f'    {{"{modname}", "{filename}", {array}, sizeof({array})}},', file=fout)
+    print("    {nullptr, nullptr, nullptr, 0}", file=fout)
+    print("};", file=fout)
+    print("/* End Of File */", file=fout)
+
+
 def str2bool(v):
     if v.lower() in ('yes', 'true', 't', 'y', '1'):
         return True
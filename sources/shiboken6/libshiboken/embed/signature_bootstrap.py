@@ -26,6 +26,7 @@ recursion_trap = 0
 import base64
 import importlib
 import io
+import marshal
 import sys
 import traceback
 import zipfile
@@ -71,12 +72,22 @@ def bootstrap():
             sys.exit(-1)
         target.remove(support_path)
 
-    target, support_path = prepare_zipfile()
+    target, support_path = prepare_importer()
     with ensure_shibokensupport(target, support_path):
         from shibokensupport.signature import loader
     return loader
 
 
+def prepare_importer():
+    """
+    Use the precompiled code objects when signature_globals.cpp found them
+    valid for this interpreter, otherwise the zip archive with the sources.
+    """
+    if "embedded_code" in globals():
+        return sys.meta_path, EmbeddedCodeImporter(embedded_code)
+    return prepare_zipfile()
+
+
 # New functionality: Loading from a zip archive.
 # There exists the zip importer, but as it is written, only real zip files are
 # supported. Before I will start an own implementation, it is easiest to use
@@ -129,13 +140,39 @@ class EmbeddableZipImporter(object):
         with self.zfile.open(filename, "r") as f:   # "rb" not for zipfile
             codeob = compile(f.read(), filename, "exec")
             exec(codeob, module.__dict__)
-        module.__file__ = filename
-        module.__loader__ = self
-        if filename.endswith("/__init__.py"):
-            module.__path__ = []
-            module.__package__ = fullname
-        else:
-            module.__package__ = fullname.rpartition('.')[0]
-        sys.modules[fullname] = module
+        finish_module(module, fullname, filename, self)
+
+
+class EmbeddedCodeImporter(object):
+    """
+    Import the marshalled code objects which are embedded in the shared
+    library. 'code_dict' maps module names to (filename, memoryview).
+    """
+
+    def __init__(self, code_dict):
+        self._code = code_dict
+
+    def find_spec(self, fullname, path, target=None):
+        return ModuleSpec(fullname, self) if fullname in self._code else None
+
+    def create_module(self, spec):
+        return None
+
+    def exec_module(self, module):
+        fullname = module.__spec__.name
+        filename, data = self._code[fullname]
+        exec(marshal.loads(data), module.__dict__)
+        finish_module(module, fullname, filename, self)
+
+
+def finish_module(module, fullname, filename, loader):
+    module.__file__ = filename
+    module.__loader__ = loader
+    if filename.endswith("/__init__.py"):
+        module.__path__ = []
+        module.__package__ = fullname
+    else:
+        module.__package__ = fullname.rpartition('.')[0]
+    sys.modules[fullname] = module
 
 # eof
@@ -145,6 +145,7 @@ check_PyTypeObject_valid()
         || probe_tp_is_gc           != check->tp_is_gc
         || probe_tp_bases           != typetype->tp_bases
         || probe_tp_mro             != typetype->tp_mro
+        || check->tp_cache          != nullptr
         || Py_TPFLAGS_DEFAULT       != (check->tp_flags & Py_TPFLAGS_DEFAULT))
         Py_FatalError("The structure of type objects has changed!");
     Py_DECREF(check);
@@ -885,6 +886,8 @@ init_PepRuntime()
 /*
  * PyTypeObject extender
  */
+#ifdef PYPY_VERSION
+
 static std::unordered_map<PyTypeObject *, SbkObjectTypePrivate > SOTP_extender{};
 static thread_local PyTypeObject *SOTP_key{};
 static thread_local SbkObjectTypePrivate *SOTP_value{};
@@ -909,6 +912,82 @@ void PepType_SOTP_delete(PyTypeObject *sbkType)
     SOTP_key = nullptr;
 }
 
+#else // PYPY_VERSION
+
+/*
+ * The private data of a type lives in a small Python object which is kept
+ * in the `tp_cache` slot of the type. Python does not use that slot itself,
+ * it only visits it in the garbage collector and releases it in
+ * `type_dealloc`, and it is not inherited by subtypes. This turns the
+ * lookup into a pointer load instead of a hash, also when alternating
+ * between types. The types created by `SbkType_FromSpecBasesMeta` get
+ * their metatype assigned after allocation, so extra space behind the
+ * metatype's basicsize cannot be used for them.
+ */
+struct SbkObjectTypePrivateHolder
+{
+    PyObject_HEAD
+    SbkObjectTypePrivate sotp;
+};
+
+static void SbkObjectTypePrivateHolder_tp_dealloc(PyObject *self)
+{
+    PyTypeObject *type = Py_TYPE(self);
+    PyObject_Free(self);
+    if (PepRuntime_38_flag) {
+        // PYSIDE-939: Handling references correctly.
+        Py_DECREF(type);
+    }
+}
+
+static PyType_Slot SbkObjectTypePrivateHolder_slots[] = {
+    {Py_tp_dealloc, reinterpret_cast<void *>(SbkObjectTypePrivateHolder_tp_dealloc)},
+    {0, nullptr}
+};
+
+static PyType_Spec SbkObjectTypePrivateHolder_spec = {
+    "Shiboken.ObjectTypePrivate",
+    sizeof(SbkObjectTypePrivateHolder),
+    0,
+    Py_TPFLAGS_DEFAULT,
+    SbkObjectTypePrivateHolder_slots,
+};
+
+static PyTypeObject *SbkObjectTypePrivateHolder_TypeF()
+{
+    static auto *type = reinterpret_cast<PyTypeObject *>(
+        PyType_FromSpec(&SbkObjectTypePrivateHolder_spec));
+    return type;
+}
+
+static SbkObjectTypePrivate *createSOTP(PyTypeObject *sbkType)
+{
+    auto *holder = PyObject_New(SbkObjectTypePrivateHolder,
+                                SbkObjectTypePrivateHolder_TypeF());
+    if (holder == nullptr)
+        Py_FatalError("Cannot allocate the private data of a Shiboken type");
+    memset(&holder->sotp, 0, sizeof(SbkObjectTypePrivate));
+    sbkType->tp_cache = reinterpret_cast<PyObject *>(holder);
+    return &holder->sotp;
+}
+
+SbkObjectTypePrivate *PepType_SOTP(PyTypeObject *sbkType)
+{
+    auto *holder = reinterpret_cast<SbkObjectTypePrivateHolder *>(sbkType->tp_cache);
+    if (holder != nullptr) {
+        assert(Py_TYPE(holder) == SbkObjectTypePrivateHolder_TypeF());
+        return &holder->sotp;
+    }
+    return createSOTP(sbkType);
+}
+
+void PepType_SOTP_delete(PyTypeObject *sbkType)
+{
+    Py_CLEAR(sbkType->tp_cache);
+}
+
+#endif // PYPY_VERSION
+
 /*
  * SbkEnumType extender
  */
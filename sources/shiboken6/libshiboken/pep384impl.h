@@ -93,6 +93,7 @@ typedef struct _typeobject {
     inquiry tp_is_gc; /* For PyObject_IS_GC */
     PyObject *tp_bases;
     PyObject *tp_mro; /* method resolution order */
+    PyObject *tp_cache; /* holds the SbkObjectTypePrivate, see pep384impl.cpp */
 
 } PyTypeObject;
 
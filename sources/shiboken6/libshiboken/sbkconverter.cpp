@@ -9,6 +9,7 @@
 #include "autodecref.h"
 #include "helper.h"
 #include "voidptr.h"
+#include "sbkstatistics_p.h"
 
 #include <string>
 #include <unordered_map>
@@ -412,9 +413,12 @@ void registerConverterName(SbkConverter *converter , const char *typeName)
 
 SbkConverter *getConverter(const char *typeName)
 {
+    Statistics::add(Statistics::ConverterNameLookups);
+    SBK_TRACE1(converter_lookup, typeName);
     ConvertersMap::const_iterator it = converters.find(typeName);
     if (it != converters.end())
         return it->second;
+    Statistics::add(Statistics::ConverterNameMisses);
     if (Py_VerboseFlag > 0) {
         const std::string message =
             std::string("Can't find type resolver for type '") + typeName + "'.";
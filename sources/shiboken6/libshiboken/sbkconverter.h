@@ -378,6 +378,104 @@ template<> inline SbkConverter *PrimitiveTypeConverter<unsigned short>() { retur
 template<> inline SbkConverter *PrimitiveTypeConverter<void *>() { return primitiveTypeConverter(SBK_VOIDPTR_IDX); }
 template<> inline SbkConverter *PrimitiveTypeConverter<std::nullptr_t>() { return primitiveTypeConverter(SBK_NULLPTR_T_IDX); }
 
+/**
+ *  Inline conversions of the most common primitive types used by the generated
+ *  code. check() accepts only the exact Python types, toCpp() returns false
+ *  if the value cannot be converted without error (out of range, other type),
+ *  in which case the regular converter must be used, which also reports the
+ *  error. No Python error is set by the fast path. Other types do not have one.
+ */
+template<typename T>
+struct PrimitiveFastPath
+{
+    static bool check(PyObject *) { return false; }
+    static bool toCpp(PyObject *, T *) { return false; }
+};
+
+template<>
+struct PrimitiveFastPath<int>
+{
+    static bool check(PyObject *pyIn) { return PyLong_CheckExact(pyIn); }
+    static bool toCpp(PyObject *pyIn, int *cppOut)
+    {
+        if (!PyLong_CheckExact(pyIn))
+            return false;
+        int overflow = 0;
+        const long value = PyLong_AsLongAndOverflow(pyIn, &overflow);
+        if (overflow != 0 || value < std::numeric_limits<int>::min()
+            || value > std::numeric_limits<int>::max()) {
+            return false;
+        }
+        *cppOut = int(value);
+        return true;
+    }
+};
+
+template<typename FLOAT>
+struct FloatFastPath
+{
+    static bool check(PyObject *pyIn) { return PyFloat_CheckExact(pyIn) || PyLong_CheckExact(pyIn); }
+    static bool toCpp(PyObject *pyIn, FLOAT *cppOut)
+    {
+        if (PyFloat_CheckExact(pyIn)) {
+            *cppOut = FLOAT(PyFloat_AS_DOUBLE(pyIn));
+            return true;
+        }
+        if (!PyLong_CheckExact(pyIn))
+            return false;
+        int overflow = 0;
+        const long value = PyLong_AsLongAndOverflow(pyIn, &overflow);
+        if (overflow != 0) {
+            return false;
+        }
+        *cppOut = FLOAT(value);
+        return true;
+    }
+};
+
+template<> struct PrimitiveFastPath<double> : FloatFastPath<double> {};
+template<> struct PrimitiveFastPath<float> : FloatFastPath<float> {};
+
+template<>
+struct PrimitiveFastPath<bool>
+{
+    static bool check(PyObject *pyIn) { return pyIn == Py_True || pyIn == Py_False; }
+    static bool toCpp(PyObject *pyIn, bool *cppOut)
+    {
+        if (!check(pyIn))
+            return false;
+        *cppOut = pyIn == Py_True;
+        return true;
+    }
+};
+
+/// Python to C++ conversion function of the primitive type T trying the fast path first.
+template<typename T>
+void primitivePythonToCppCopy(PyObject *pyIn, void *cppOut)
+{
+    if (!PrimitiveFastPath<T>::toCpp(pyIn, reinterpret_cast<T *>(cppOut)))
+        pythonToCppCopy(PrimitiveTypeConverter<T>(), pyIn, cppOut);
+}
+
+/// Same as pythonToCppConversion(PrimitiveTypeConverter<T>(), pyIn) without
+/// going through the converter for the exact Python types of T.
+template<typename T>
+inline PythonToCppConversion primitivePythonToCppConversion(PyObject *pyIn)
+{
+    if (PrimitiveFastPath<T>::check(pyIn))
+        return {primitivePythonToCppCopy<T>, PythonToCppConversion::Value};
+    return pythonToCppConversion(PrimitiveTypeConverter<T>(), pyIn);
+}
+
+/// Converts \p pyIn to the primitive type T inline if possible, else calls
+/// the conversion \p toCpp returned by the convertible check.
+template<typename Conversion, typename T>
+inline void primitivePythonToCpp(const Conversion &toCpp, PyObject *pyIn, T *cppOut)
+{
+    if (!PrimitiveFastPath<T>::toCpp(pyIn, cppOut))
+        toCpp(pyIn, cppOut);
+}
+
 } // namespace Shiboken::Conversions
 
 /**
@@ -107,6 +107,16 @@ struct OverFlowCheckerBase {
         }
         return false;
     }
+
+    // Error path of the checkers: the string representation is only built
+    // when an overflow was detected, so that the common case of a value in
+    // range does not allocate.
+    static void reportOverFlow(const MaxLimitType &value, PyObject *pyIn)
+    {
+        std::string valueAsString;
+        checkForInternalPyOverflow(pyIn, valueAsString);
+        formatOverFlowMessage(value, &valueAsString);
+    }
 };
 
 // Helper template for checking if a value overflows when cast to type T.
@@ -122,13 +132,11 @@ struct OverFlowChecker<T, MaxLimitType, true> :
         public OverFlowCheckerBase<T, MaxLimitType, true> {
     static bool check(const MaxLimitType &value, PyObject *pyIn)
     {
-        std::string valueAsString;
-        const bool isOverflow =
-            OverFlowChecker::checkForInternalPyOverflow(pyIn, valueAsString)
+        const bool isOverflow = PyErr_Occurred() != nullptr
             || value < std::numeric_limits<T>::min()
             || value > std::numeric_limits<T>::max();
         if (isOverflow)
-            OverFlowChecker::formatOverFlowMessage(value, &valueAsString);
+            OverFlowChecker::reportOverFlow(value, pyIn);
         return isOverflow;
     }
 };
@@ -138,13 +146,11 @@ struct OverFlowChecker<T, MaxLimitType, false>
         : public OverFlowCheckerBase<T, MaxLimitType, false> {
     static bool check(const MaxLimitType &value, PyObject *pyIn)
     {
-        std::string valueAsString;
-        const bool isOverflow =
-            OverFlowChecker::checkForInternalPyOverflow(pyIn, valueAsString)
+        const bool isOverflow = PyErr_Occurred() != nullptr
             || value < 0
             || static_cast<unsigned long long>(value) > std::numeric_limits<T>::max();
         if (isOverflow)
-            OverFlowChecker::formatOverFlowMessage(value, &valueAsString);
+            OverFlowChecker::reportOverFlow(value, pyIn);
         return isOverflow;
     }
 };
@@ -152,12 +158,10 @@ template<>
 struct OverFlowChecker<PY_LONG_LONG, PY_LONG_LONG, true> :
         public OverFlowCheckerBase<PY_LONG_LONG, PY_LONG_LONG, true> {
     static bool check(const PY_LONG_LONG &value, PyObject *pyIn) {
-        std::string valueAsString;
-        const bool isOverflow = checkForInternalPyOverflow(pyIn, valueAsString);
+        const bool isOverflow = PyErr_Occurred() != nullptr;
         if (isOverflow)
-            OverFlowChecker::formatOverFlowMessage(value, &valueAsString);
+            OverFlowChecker::reportOverFlow(value, pyIn);
         return isOverflow;
-
     }
 };
 template<>
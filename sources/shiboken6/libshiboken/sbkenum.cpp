@@ -367,6 +367,48 @@ PyObject *unpickleEnum(PyObject *enum_class_name, PyObject *value)
 
 int enumOption{};
 
+static unsigned shortcutDictVersionCounter = 1;
+
+unsigned shortcutDictVersion()
+{
+    return shortcutDictVersionCounter;
+}
+
+void invalidateShortcutDicts()
+{
+    ++shortcutDictVersionCounter;
+}
+
+void invalidateShortcutDicts(PyTypeObject *type)
+{
+    ++PepType_SOTP(type)->enumShortcutTypeVersion;
+}
+
+unsigned shortcutDictMroVersion(PyTypeObject *type)
+{
+    static PyTypeObject *const sbkObjectType = SbkObjectType_TypeF();
+    unsigned result = 0;
+    PyObject *mro = type->tp_mro;
+    for (Py_ssize_t idx = 0, n = PyTuple_GET_SIZE(mro); idx < n; ++idx) {
+        PyObject *base = PyTuple_GET_ITEM(mro, idx);
+        if (PyObject_TypeCheck(base, sbkObjectType))
+            result += PepType_SOTP(reinterpret_cast<PyTypeObject *>(base))->enumShortcutTypeVersion;
+    }
+    return result;
+}
+
+bool affectsShortcutDicts(PyTypeObject *type, PyObject *name, PyObject *value)
+{
+    // Types with enums also map the old flags names to their flag types.
+    if (PepType_SOTP(type)->enumFlagInfo != nullptr)
+        return true;
+    static PyTypeObject *const EnumMeta = getPyEnumMeta();
+    if (value != nullptr && Py_TYPE(value) == EnumMeta)
+        return true;
+    PyObject *oldValue = PyDict_GetItem(type->tp_dict, name);
+    return oldValue != nullptr && Py_TYPE(oldValue) == EnumMeta;
+}
+
 } // namespace Enum
 } // namespace Shiboken
 
@@ -612,6 +654,7 @@ PyTypeObject *createScopedEnum(PyTypeObject *scope, const char *name, const char
                                const char *cppName, PyTypeObject *flagsType)
 {
     PyTypeObject *enumType = createEnum(fullName, cppName, flagsType);
+    Enum::invalidateShortcutDicts(scope);
     if (enumType && PyDict_SetItemString(scope->tp_dict, name,
             reinterpret_cast<PyObject *>(enumType)) < 0) {
         Py_DECREF(enumType);
@@ -657,6 +700,8 @@ bool createScopedEnumItem(PyTypeObject *enumType, PyTypeObject *scope,
     PyObject *enumItem = createEnumItem(enumType, itemName, itemValue);
     if (!enumItem)
         return false;
+    if (useOldEnum)
+        Enum::invalidateShortcutDicts(scope);
     int ok = useOldEnum ? PyDict_SetItemString(scope->tp_dict, itemName, enumItem) : true;
     Py_DECREF(enumItem);
     return ok >= 0;
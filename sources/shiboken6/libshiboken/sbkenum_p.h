@@ -48,6 +48,20 @@ enum : int {
 
 LIBSHIBOKEN_API extern int enumOption;
 
+/// Version of the enum compatibility lookup dicts of all types, see
+/// mangled_type_getattro(). It is incremented when the MRO of a type changes.
+unsigned shortcutDictVersion();
+void invalidateShortcutDicts();
+/// Invalidate the enum compatibility lookup dicts of \a type and its
+/// subclasses, to be called when enums are added to, replaced in or removed
+/// from it. The subclasses notice it by the sum of the versions of the types
+/// along their MRO, see shortcutDictMroVersion().
+void invalidateShortcutDicts(PyTypeObject *type);
+unsigned shortcutDictMroVersion(PyTypeObject *type);
+/// Returns whether setting the attribute \a name of \a type to \a value
+/// (nullptr for deleting) may change enum compatibility names.
+bool affectsShortcutDicts(PyTypeObject *type, PyObject *name, PyObject *value);
+
 }}
 
 #endif // SBKENUM_P_H
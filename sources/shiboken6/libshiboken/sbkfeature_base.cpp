@@ -12,6 +12,10 @@
 #include "sbkfeature_base.h"
 #include "gilstate.h"
 
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
 using namespace Shiboken;
 
 extern "C"
@@ -88,27 +92,13 @@ static int _getVersion()
     return number;
 }
 
-static bool currentOpcode_Is_CallMethNoArgs()
+static bool opcode_Is_CallMethNoArgs(PyObject *f_code, Py_ssize_t f_lasti)
 {
-    // We look into the currently active operation if we are going to call
-    // a method with zero arguments.
-    auto *frame = PyEval_GetFrame();
-#if PY_VERSION_HEX >= 0x03090000 && !Py_LIMITED_API && !defined(PYPY_VERSION)
-    auto *f_code = PyFrame_GetCode(frame);
-#else
-    static PyObject *const _f_code = Shiboken::String::createStaticString("f_code");
-    AutoDecRef dec_f_code(PyObject_GetAttr(reinterpret_cast<PyObject *>(frame), _f_code));
-    auto *f_code = dec_f_code.object();
-#endif
 #if PY_VERSION_HEX >= 0x030B0000 && !Py_LIMITED_API
-    AutoDecRef dec_co_code(PyCode_GetCode(f_code));
-    Py_ssize_t f_lasti = PyFrame_GetLasti(frame);
+    AutoDecRef dec_co_code(PyCode_GetCode(reinterpret_cast<PyCodeObject *>(f_code)));
 #else
-    static PyObject *const _f_lasti = Shiboken::String::createStaticString("f_lasti");
     static PyObject *const _co_code = Shiboken::String::createStaticString("co_code");
-    AutoDecRef dec_co_code(PyObject_GetAttr(reinterpret_cast<PyObject *>(f_code), _co_code));
-    AutoDecRef dec_f_lasti(PyObject_GetAttr(reinterpret_cast<PyObject *>(frame), _f_lasti));
-    Py_ssize_t f_lasti = PyLong_AsSsize_t(dec_f_lasti);
+    AutoDecRef dec_co_code(PyObject_GetAttr(f_code, _co_code));
 #endif
     Py_ssize_t code_len;
     char *co_code{};
@@ -138,6 +128,64 @@ static bool currentOpcode_Is_CallMethNoArgs()
     return opcode2 == PRECALL && oparg2 == 0;
 }
 
+// The result of opcode_Is_CallMethNoArgs() per code object and instruction.
+// The cache holds a reference to the code objects so that their addresses are
+// not reused while they are in the cache. It is cleared when it gets too big.
+using OpcodeCacheKey = std::pair<PyObject *, Py_ssize_t>;
+
+struct OpcodeCacheKeyHash
+{
+    size_t operator()(const OpcodeCacheKey &key) const noexcept
+    {
+        return std::hash<PyObject *>()(key.first) ^ (size_t(key.second) << 1);
+    }
+};
+
+using OpcodeCache = std::unordered_map<OpcodeCacheKey, bool, OpcodeCacheKeyHash>;
+
+static constexpr size_t opcodeCacheMaxSize = 4096;
+
+static bool cachedOpcode_Is_CallMethNoArgs(PyObject *f_code, Py_ssize_t f_lasti)
+{
+    static OpcodeCache cache;
+    const OpcodeCacheKey key{f_code, f_lasti};
+    auto it = cache.find(key);
+    if (it != cache.end())
+        return it->second;
+    if (cache.size() >= opcodeCacheMaxSize) {
+        for (auto &entry : cache)
+            Py_DECREF(entry.first.first);
+        cache.clear();
+    }
+    const bool result = opcode_Is_CallMethNoArgs(f_code, f_lasti);
+    Py_INCREF(f_code);
+    cache.insert({key, result});
+    return result;
+}
+
+static bool currentOpcode_Is_CallMethNoArgs()
+{
+    // We look into the currently active operation if we are going to call
+    // a method with zero arguments.
+    auto *frame = PyEval_GetFrame();
+    if (frame == nullptr)
+        return false;
+#if PY_VERSION_HEX >= 0x03090000 && !Py_LIMITED_API && !defined(PYPY_VERSION)
+    AutoDecRef dec_f_code(reinterpret_cast<PyObject *>(PyFrame_GetCode(frame)));
+#else
+    static PyObject *const _f_code = Shiboken::String::createStaticString("f_code");
+    AutoDecRef dec_f_code(PyObject_GetAttr(reinterpret_cast<PyObject *>(frame), _f_code));
+#endif
+#if PY_VERSION_HEX >= 0x030B0000 && !Py_LIMITED_API
+    Py_ssize_t f_lasti = PyFrame_GetLasti(frame);
+#else
+    static PyObject *const _f_lasti = Shiboken::String::createStaticString("f_lasti");
+    AutoDecRef dec_f_lasti(PyObject_GetAttr(reinterpret_cast<PyObject *>(frame), _f_lasti));
+    Py_ssize_t f_lasti = PyLong_AsSsize_t(dec_f_lasti);
+#endif
+    return cachedOpcode_Is_CallMethNoArgs(dec_f_code.object(), f_lasti);
+}
+
 void initEnumFlagsDict(PyTypeObject *type)
 {
     // We create a dict for all flag enums that holds the original C++ name
@@ -172,6 +220,74 @@ static PyObject *replaceNoArgWithZero(PyObject *callable)
     return PyObject_CallFunctionObjArgs(partial, callable, zero, nullptr);
 }
 
+
+// Return a flat dict of the names which are resolved by the enum
+// compatibility lookup of mangled_type_getattro() along the MRO of the type:
+// Old flags names mapped to the flag type (part 1) and enum values duplicated
+// into the enclosing scope mapped to the enum member (part 2). The first base
+// providing a name wins. The dict is rebuilt when enum names of a type along
+// the MRO changed after it was built, see Enum::shortcutDictMroVersion().
+static PyObject *enumShortcutDict(PyTypeObject *type)
+{
+    static PyTypeObject *const EnumMeta = getPyEnumMeta();
+    static PyObject *const _member_map_ = String::createStaticString("_member_map_");
+
+    auto *sotp = PepType_SOTP(type);
+    const unsigned version = Enum::shortcutDictVersion();
+    const unsigned mroVersion = Enum::shortcutDictMroVersion(type);
+    if (sotp->enumShortcutDict != nullptr && sotp->enumShortcutDictVersion == version
+        && sotp->enumShortcutDictMroVersion == mroVersion) {
+        return sotp->enumShortcutDict;
+    }
+
+    auto *result = PyDict_New();
+    const bool useFakeRenames = !(Enum::enumOption & Enum::ENOPT_NO_FAKERENAMES);
+    const bool useFakeShortcuts = !(Enum::enumOption & Enum::ENOPT_NO_FAKESHORTCUT);
+    PyObject *mro = type->tp_mro;
+    assert(PyTuple_Check(mro));
+    for (Py_ssize_t idx = 0, n = PyTuple_GET_SIZE(mro); idx < n; ++idx) {
+        auto *type_base = reinterpret_cast<PyTypeObject *>(PyTuple_GET_ITEM(mro, idx));
+        auto *base_sotp = PepType_SOTP(type_base);
+        // The EnumFlagInfo structure tells us if there are Enums at all.
+        if (base_sotp->enumFlagInfo == nullptr)
+            continue;
+        if (!base_sotp->enumFlagsDict)
+            initEnumFlagsDict(type_base);
+        auto *dict = type_base->tp_dict;
+        PyObject *key, *value;
+        Py_ssize_t pos = 0;
+        if (useFakeRenames) {
+            while (PyDict_Next(base_sotp->enumFlagsDict, &pos, &key, &value)) {
+                auto *flagType = PyDict_GetItem(dict, value);
+                if (flagType != nullptr && PyDict_GetItem(result, key) == nullptr)
+                    PyDict_SetItem(result, key, flagType);
+            }
+        }
+        if (useFakeShortcuts) {
+            pos = 0;
+            while (PyDict_Next(dict, &pos, &key, &value)) {
+                if (Py_TYPE(value) != EnumMeta)
+                    continue;
+                auto *valtype = reinterpret_cast<PyTypeObject *>(value);
+                auto *member_map = PyDict_GetItem(valtype->tp_dict, _member_map_);
+                if (member_map == nullptr || !PyDict_Check(member_map))
+                    continue;
+                PyObject *memberName, *member;
+                Py_ssize_t memberPos = 0;
+                while (PyDict_Next(member_map, &memberPos, &memberName, &member)) {
+                    if (PyDict_GetItem(result, memberName) == nullptr)
+                        PyDict_SetItem(result, memberName, member);
+                }
+            }
+        }
+    }
+    Py_XDECREF(sotp->enumShortcutDict);
+    sotp->enumShortcutDict = result;
+    sotp->enumShortcutDictVersion = version;
+    sotp->enumShortcutDictMroVersion = mroVersion;
+    return result;
+}
+
 PyObject *mangled_type_getattro(PyTypeObject *type, PyObject *name)
 {
     /*
@@ -184,7 +300,6 @@ PyObject *mangled_type_getattro(PyTypeObject *type, PyObject *name)
     static PyObject *const ignAttr1 = PyName::qtStaticMetaObject();
     static PyObject *const ignAttr2 = PyMagicName::get();
     static PyTypeObject *const EnumMeta = getPyEnumMeta();
-    static PyObject *const _member_map_ = String::createStaticString("_member_map_");
 
     if (SelectFeatureSet != nullptr)
         SelectFeatureSet(type);
@@ -200,14 +315,12 @@ PyObject *mangled_type_getattro(PyTypeObject *type, PyObject *name)
     //      Qt.AlignLeft instead of Qt.Alignment.AlignLeft, is still implemented but
     //      no longer advertized in PYI files or line completion.
 
-    if (ret && Py_TYPE(ret) == EnumMeta && currentOpcode_Is_CallMethNoArgs()) {
-        bool useZeroDefault = !(Enum::enumOption & Enum::ENOPT_NO_ZERODEFAULT);
-        if (useZeroDefault) {
-            // We provide a zero argument for compatibility if it is a call with no args.
-            auto *hold = replaceNoArgWithZero(ret);
-            Py_DECREF(ret);
-            ret = hold;
-        }
+    const bool useZeroDefault = !(Enum::enumOption & Enum::ENOPT_NO_ZERODEFAULT);
+    if (ret && useZeroDefault && Py_TYPE(ret) == EnumMeta && currentOpcode_Is_CallMethNoArgs()) {
+        // We provide a zero argument for compatibility if it is a call with no args.
+        auto *hold = replaceNoArgWithZero(ret);
+        Py_DECREF(ret);
+        ret = hold;
     }
 
     if (!ret && name != ignAttr1 && name != ignAttr2) {
@@ -215,82 +328,49 @@ PyObject *mangled_type_getattro(PyTypeObject *type, PyObject *name)
         PyErr_Fetch(&error_type, &error_value, &error_traceback);
 
         // This is similar to `find_name_in_mro`, but instead of looking directly into
-        // tp_dict, we also search for the attribute in local classes of that dict (Part 2).
-        PyObject *mro = type->tp_mro;
-        assert(PyTuple_Check(mro));
-        size_t idx, n = PyTuple_GET_SIZE(mro);
-        for (idx = 0; idx < n; ++idx) {
-            auto *base = PyTuple_GET_ITEM(mro, idx);
-            auto *type_base = reinterpret_cast<PyTypeObject *>(base);
-            auto sotp = PepType_SOTP(type_base);
-            // The EnumFlagInfo structure tells us if there are Enums at all.
-            const char **enumFlagInfo = sotp->enumFlagInfo;
-            if (!(enumFlagInfo))
-                continue;
-            if (!sotp->enumFlagsDict)
-                initEnumFlagsDict(type_base);
-            bool useFakeRenames = !(Enum::enumOption & Enum::ENOPT_NO_FAKERENAMES);
-            if (useFakeRenames) {
-                auto *rename = PyDict_GetItem(sotp->enumFlagsDict, name);
-                if (rename) {
-                    /*
-                     * Part 1: Look into the enumFlagsDict if we have an old flags name.
-                     * -------------------------------------------------------------
-                     * We need to replace the parameterless
-
-                        QtCore.Qt.Alignment()
-
-                     * by the one-parameter call
-
-                        QtCore.Qt.AlignmentFlag(0)
-
-                     * That means: We need to bind the zero as default into a wrapper and
-                     * return that to be called.
-                     *
-                     * Addendum:
-                     * ---------
-                     * We first need to look into the current opcode of the bytecode to find
-                     * out if we have a call like above or just a type lookup.
-                     */
-                    auto *flagType = PyDict_GetItem(type_base->tp_dict, rename);
-                    if (currentOpcode_Is_CallMethNoArgs())
-                        return replaceNoArgWithZero(flagType);
-                    Py_INCREF(flagType);
-                    return flagType;
-                }
-            }
-            bool useFakeShortcuts = !(Enum::enumOption & Enum::ENOPT_NO_FAKESHORTCUT);
-            if (useFakeShortcuts) {
-                auto *dict = type_base->tp_dict;
-                PyObject *key, *value;
-                Py_ssize_t pos = 0;
-                while (PyDict_Next(dict, &pos, &key, &value)) {
-                    /*
-                     * Part 2: Check for a duplication into outer scope.
-                     * -------------------------------------------------
-                     * We need to replace the shortcut
-
-                        QtCore.Qt.AlignLeft
-
-                     * by the correct call
-
-                        QtCore.Qt.AlignmentFlag.AlignLeft
-
-                     * That means: We need to search all Enums of the class.
-                     */
-                    if (Py_TYPE(value) == EnumMeta) {
-                        auto *valtype = reinterpret_cast<PyTypeObject *>(value);
-                        auto *member_map = PyDict_GetItem(valtype->tp_dict, _member_map_);
-                        if (member_map && PyDict_Check(member_map)) {
-                            auto *result = PyDict_GetItem(member_map, name);
-                            if (result) {
-                                Py_INCREF(result);
-                                return result;
-                            }
-                        }
-                    }
-                }
-            }
+        // tp_dict, we also search for the attribute in local classes of that dict.
+        // The names are precomputed into one dict for the whole MRO.
+        auto *found = PyDict_GetItem(enumShortcutDict(type), name);
+        if (found != nullptr) {
+            Py_XDECREF(error_type);
+            Py_XDECREF(error_value);
+            Py_XDECREF(error_traceback);
+            /*
+             * Part 1: Look into the enumFlagsDict if we have an old flags name.
+             * -------------------------------------------------------------
+             * We need to replace the parameterless
+
+                QtCore.Qt.Alignment()
+
+             * by the one-parameter call
+
+                QtCore.Qt.AlignmentFlag(0)
+
+             * That means: We need to bind the zero as default into a wrapper and
+             * return that to be called.
+             *
+             * Addendum:
+             * ---------
+             * We first need to look into the current opcode of the bytecode to find
+             * out if we have a call like above or just a type lookup.
+             */
+            if (PyType_Check(found) && currentOpcode_Is_CallMethNoArgs())
+                return replaceNoArgWithZero(found);
+            /*
+             * Part 2: Check for a duplication into outer scope.
+             * -------------------------------------------------
+             * We need to replace the shortcut
+
+                QtCore.Qt.AlignLeft
+
+             * by the correct call
+
+                QtCore.Qt.AlignmentFlag.AlignLeft
+
+             * The enum members are found in the dict as well.
+             */
+            Py_INCREF(found);
+            return found;
         }
         PyErr_Restore(error_type, error_value, error_traceback);
     }
@@ -336,11 +416,42 @@ const char **SbkObjectType_GetPropertyStrings(PyTypeObject *type)
     return PepType_SOTP(type)->propertyStrings;
 }
 
+int SbkObjectType_GetSelectId(PyTypeObject *type, unsigned version)
+{
+    auto *sotp = PepType_SOTP(type);
+    return sotp->featureSelectVersion == version ? sotp->featureSelectId : -1;
+}
+
+void SbkObjectType_SetSelectId(PyTypeObject *type, int selectId, unsigned version)
+{
+    auto *sotp = PepType_SOTP(type);
+    sotp->featureSelectId = selectId;
+    sotp->featureSelectVersion = version;
+}
+
 void SbkObjectType_SetPropertyStrings(PyTypeObject *type, const char **strings)
 {
     PepType_SOTP(type)->propertyStrings = strings;
 }
 
+PyMethodDef *SbkObjectType_GetSnakeCaseMethods(PyTypeObject *type)
+{
+    return PepType_SOTP(type)->snakeCaseMethods;
+}
+
+const char **SbkObjectType_GetSnakeCasePropertyStrings(PyTypeObject *type)
+{
+    return PepType_SOTP(type)->snakeCasePropertyStrings;
+}
+
+void SbkObjectType_SetSnakeCaseNames(PyTypeObject *type, PyMethodDef *methods,
+                                     const char **propertyStrings)
+{
+    auto *sotp = PepType_SOTP(type);
+    sotp->snakeCaseMethods = methods;
+    sotp->snakeCasePropertyStrings = propertyStrings;
+}
+
 void SbkObjectType_SetEnumFlagInfo(PyTypeObject *type, const char **strings)
 {
     PepType_SOTP(type)->enumFlagInfo = strings;
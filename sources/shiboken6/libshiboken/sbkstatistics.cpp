@@ -0,0 +1,74 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "sbkstatistics_p.h"
+#include "bindingmanager.h"
+
+namespace Shiboken
+{
+namespace Statistics
+{
+
+#ifdef SHIBOKEN_STATISTICS
+
+std::atomic<unsigned long long> counters[CounterCount];
+
+static const char *counterNames[CounterCount] = {
+    "wrapper_map_lookups",
+    "wrapper_map_lock_contentions",
+    "override_lookups",
+    "override_hits",
+    "override_type_cache_hits",
+    "converter_name_lookups",
+    "converter_name_misses",
+    "type_resolutions",
+    "deferred_deletions",
+    "signature_init_ns"
+};
+
+bool isEnabled()
+{
+    return true;
+}
+
+PyObject *toDict()
+{
+    PyObject *result = PyDict_New();
+    for (int c = 0; c < CounterCount; ++c) {
+        PyObject *value = PyLong_FromUnsignedLongLong(counters[c].load(std::memory_order_relaxed));
+        PyDict_SetItemString(result, counterNames[c], value);
+        Py_DECREF(value);
+    }
+    const auto wrapperCount = BindingManager::instance().getAllPyObjects().size();
+    PyObject *value = PyLong_FromSize_t(wrapperCount);
+    PyDict_SetItemString(result, "wrappers", value);
+    Py_DECREF(value);
+    return result;
+}
+
+void reset()
+{
+    for (auto &counter : counters)
+        counter.store(0, std::memory_order_relaxed);
+}
+
+#else // SHIBOKEN_STATISTICS
+
+bool isEnabled()
+{
+    return false;
+}
+
+PyObject *toDict()
+{
+    return PyDict_New();
+}
+
+void reset()
+{
+}
+
+#endif // !SHIBOKEN_STATISTICS
+
+} // namespace Statistics
+} // namespace Shiboken
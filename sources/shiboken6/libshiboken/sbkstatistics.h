@@ -0,0 +1,29 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef SBKSTATISTICS_H
+#define SBKSTATISTICS_H
+
+#include "sbkpython.h"
+#include "shibokenmacros.h"
+
+namespace Shiboken
+{
+namespace Statistics
+{
+
+/// Returns whether libshiboken was built with the SHIBOKEN_STATISTICS option
+/// counting the calls of its hot paths.
+LIBSHIBOKEN_API bool isEnabled();
+
+/// Returns a new dict with the current values of the counters and the
+/// number of wrappers. It is empty when the statistics are disabled.
+LIBSHIBOKEN_API PyObject *toDict();
+
+/// Resets all counters to 0.
+LIBSHIBOKEN_API void reset();
+
+} // namespace Statistics
+} // namespace Shiboken
+
+#endif // SBKSTATISTICS_H
@@ -0,0 +1,94 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef SBKSTATISTICS_P_H
+#define SBKSTATISTICS_P_H
+
+#include "sbkstatistics.h"
+
+#ifdef SHIBOKEN_STATISTICS
+#  include <atomic>
+#  include <chrono>
+#endif
+
+// Static tracepoints (USDT) for perf, bpftrace or SystemTap, for example:
+// "perf probe -x libshiboken6.abi3.so sdt_shiboken:type_resolution".
+// They are a no-op unless a tracer attaches to them, but their arguments are
+// always evaluated, so they must not convert or allocate.
+#ifdef SHIBOKEN_HAVE_SDT
+#  include <sys/sdt.h>
+#  define SBK_TRACE(name) DTRACE_PROBE(shiboken, name)
+#  define SBK_TRACE1(name, arg1) DTRACE_PROBE1(shiboken, name, arg1)
+#  define SBK_TRACE2(name, arg1, arg2) DTRACE_PROBE2(shiboken, name, arg1, arg2)
+#else
+#  define SBK_TRACE(name)
+#  define SBK_TRACE1(name, arg1)
+#  define SBK_TRACE2(name, arg1, arg2)
+#endif
+
+namespace Shiboken
+{
+namespace Statistics
+{
+
+enum Counter
+{
+    WrapperMapLookups,          // BindingManager::retrieveWrapper()
+    WrapperMapLockContentions,  // The wrapper map lock was held by another thread
+    OverrideLookups,            // BindingManager::getOverride()
+    OverrideHits,               // getOverride() found a Python override
+    OverrideTypeCacheHits,      // The type knew that a method is not overridden
+    ConverterNameLookups,       // Conversions::getConverter() by type name
+    ConverterNameMisses,        // getConverter() did not find a converter
+    TypeResolutions,            // Object::newObject() had to find the exact type
+    DeferredDeletions,          // C++ objects to be deleted in the main thread
+    SignatureInitNanoseconds,   // Time spent initializing the signature module
+    CounterCount
+};
+
+#ifdef SHIBOKEN_STATISTICS
+
+extern std::atomic<unsigned long long> counters[CounterCount];
+
+inline void add(Counter counter, unsigned long long value = 1)
+{
+    counters[counter].fetch_add(value, std::memory_order_relaxed);
+}
+
+/// Adds the time of its lifetime to a counter in nanoseconds.
+class ScopedTimer
+{
+public:
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+    explicit ScopedTimer(Counter counter) :
+        m_counter(counter), m_start(std::chrono::steady_clock::now()) {}
+
+    ~ScopedTimer()
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - m_start;
+        add(m_counter, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+private:
+    const Counter m_counter;
+    const std::chrono::steady_clock::time_point m_start;
+};
+
+#else // SHIBOKEN_STATISTICS
+
+inline void add(Counter, unsigned long long = 1) {}
+
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(Counter) {}
+};
+
+#endif // !SHIBOKEN_STATISTICS
+
+} // namespace Statistics
+} // namespace Shiboken
+
+#endif // SBKSTATISTICS_P_H
@@ -18,6 +18,7 @@
 
 #include "basewrapper.h"
 #include "autodecref.h"
+#include "sbkstatistics_p.h"
 #include "sbkstring.h"
 #include "sbkstaticstrings.h"
 #include "sbkstaticstrings_p.h"
@@ -452,6 +453,7 @@ static int PySide_FinishSignatures(PyObject *module, const char *signatures[])
 int InitSignatureStrings(PyTypeObject *type, const char *signatures[])
 {
     init_shibokensupport_module();
+    Shiboken::Statistics::ScopedTimer timer(Shiboken::Statistics::SignatureInitNanoseconds);
     auto *ob_type = reinterpret_cast<PyObject *>(type);
     int ret = PySide_BuildSignatureArgs(ob_type, signatures);
     if (ret < 0) {
@@ -486,7 +488,9 @@ void FinishSignatureInitialization(PyObject *module, const char *signatures[])
     }
 }
 
-static PyObject *adjustFuncName(const char *func_name)
+// Adjust \a func_name for the feature selection \a selectId, which is read
+// from the type if it is negative.
+static PyObject *adjustFuncName(const char *func_name, int selectId = -1)
 {
     /*
      * PYSIDE-1019: Modify the function name expression according to feature.
@@ -535,7 +539,7 @@ static PyObject *adjustFuncName(const char *func_name)
     // Find the feature flags
     auto type = reinterpret_cast<PyTypeObject *>(obtype.object());
     auto dict = type->tp_dict;
-    int id = currentSelectId(type);
+    int id = selectId < 0 ? currentSelectId(type) : selectId;
     id = id < 0 ? 0 : id;   // if undefined, set to zero
     auto lower = id & 0x01;
     auto is_prop = id & 0x02;
@@ -569,8 +573,232 @@ static PyObject *adjustFuncName(const char *func_name)
     return String::fromCString(_buf);
 }
 
+/*
+ * Lazy argument errors.
+ *
+ * Errors about wrong arguments are often caught, for instance by code
+ * probing an API with try/except TypeError. The message needs the
+ * signatures of the function, so it is only created when the error is
+ * rendered: Shiboken.ArgumentTypeError keeps the function name, the
+ * arguments and the feature selection of the caller in the instance dict
+ * until its str(), repr(), args or __reduce__() are used. The signatures
+ * are matched only then, once.
+ */
+
+static PyObject *argumentErrorKey()
+{
+    static PyObject *const result = String::createStaticString("_sbk_argument_error");
+    return result;
+}
+
+// Call the method \a name of BaseException on \a self.
+static PyObject *callBaseExceptionMethod(const char *name, PyObject *self)
+{
+    return PyObject_CallMethod(reinterpret_cast<PyObject *>(PyExc_BaseException),
+                               name, "O", self);
+}
+
+static PyObject *baseExceptionArgs()
+{
+    static PyObject *const result =
+        PyObject_GetAttrString(reinterpret_cast<PyObject *>(PyExc_BaseException), "args");
+    return result;
+}
+
+// Returns the feature selection of the calling module, as the feature
+// module keeps it (see getFeatureSelectId() of libpyside).
+static int callerSelectId()
+{
+    if (pyside_globals == nullptr) // No module has selected features.
+        return 0;
+    PyObject *globals = PyEval_GetGlobals();
+    PyObject *modName = globals != nullptr ? PyDict_GetItem(globals, PyMagicName::name()) : nullptr;
+    PyObject *selectId = modName != nullptr
+        ? PyDict_GetItem(pyside_globals->feature_dict, modName) : nullptr;
+    const long result = selectId != nullptr && PyLong_Check(selectId) ? PyLong_AsLong(selectId) : 0;
+    return result > 0 ? int(result & 0xff) : 0;
+}
+
+static PyObject *createArgumentErrorMessage(PyObject *funcName, PyObject *args,
+                                            PyObject *info, PyObject *selectId)
+{
+    init_shibokensupport_module();
+    const char *func_name = String::toCString(funcName);
+    AutoDecRef newFuncName(adjustFuncName(func_name, int(PyLong_AsLong(selectId))));
+    if (newFuncName.isNull()) {
+        PyErr_Clear();
+        newFuncName.reset(String::fromCString(func_name));
+    }
+    AutoDecRef res(PyObject_CallFunctionObjArgs(pyside_globals->seterror_argument_func,
+                                                args, newFuncName.object(), info, nullptr));
+    if (!res.isNull() && PyTuple_Check(res) && PyTuple_Size(res) == 2) {
+        PyObject *msg = PyTuple_GetItem(res, 1);
+        Py_INCREF(msg);
+        return msg;
+    }
+    PyErr_Clear();
+    return PyUnicode_FromFormat("%s(): wrong arguments", func_name);
+}
+
+// Create the message of a lazy argument error if that has not happened, yet.
+static void formatArgumentError(PyObject *self)
+{
+    PyObject *type, *value, *traceback;
+    PyErr_Fetch(&type, &value, &traceback);
+    AutoDecRef dict(PyObject_GetAttr(self, PyMagicName::dict()));
+    PyObject *data = dict.isNull() ? nullptr : PyDict_GetItem(dict, argumentErrorKey());
+    if (data != nullptr) {
+        Py_INCREF(data);
+        AutoDecRef dataGuard(data);
+        PyDict_DelItem(dict, argumentErrorKey());
+        AutoDecRef msg(createArgumentErrorMessage(PyTuple_GetItem(data, 0),
+                                                  PyTuple_GetItem(data, 1),
+                                                  PyTuple_GetItem(data, 2),
+                                                  PyTuple_GetItem(data, 3)));
+        AutoDecRef newArgs(PyTuple_Pack(1, msg.object()));
+        AutoDecRef res(PyObject_CallMethod(baseExceptionArgs(), "__set__", "OO",
+                                           self, newArgs.object()));
+    }
+    PyErr_Clear();
+    PyErr_Restore(type, value, traceback);
+}
+
+static PyObject *ArgumentTypeError_str(PyObject *self, PyObject * /* args */)
+{
+    formatArgumentError(self);
+    return callBaseExceptionMethod("__str__", self);
+}
+
+static PyObject *ArgumentTypeError_repr(PyObject *self, PyObject * /* args */)
+{
+    formatArgumentError(self);
+    return callBaseExceptionMethod("__repr__", self);
+}
+
+// Pickle as TypeError, the type cannot be imported by its module name.
+static PyObject *ArgumentTypeError_reduce(PyObject *self, PyObject * /* args */)
+{
+    formatArgumentError(self);
+    AutoDecRef args(PyObject_CallMethod(baseExceptionArgs(), "__get__", "O", self));
+    if (args.isNull())
+        return nullptr;
+    return Py_BuildValue("(OO)", PyExc_TypeError, args.object());
+}
+
+static PyObject *ArgumentTypeError_get_args(PyObject *self, void *)
+{
+    formatArgumentError(self);
+    return PyObject_CallMethod(baseExceptionArgs(), "__get__", "O", self);
+}
+
+static int ArgumentTypeError_set_args(PyObject *self, PyObject *value, void *)
+{
+    AutoDecRef dict(PyObject_GetAttr(self, PyMagicName::dict()));
+    if (!dict.isNull() && PyDict_GetItem(dict, argumentErrorKey()) != nullptr)
+        PyDict_DelItem(dict, argumentErrorKey());
+    AutoDecRef res(value != nullptr
+                   ? PyObject_CallMethod(baseExceptionArgs(), "__set__", "OO", self, value)
+                   : PyObject_CallMethod(baseExceptionArgs(), "__delete__", "O", self));
+    return res.isNull() ? -1 : 0;
+}
+
+static PyMethodDef ArgumentTypeError_methods[] = {
+    {"__str__", reinterpret_cast<PyCFunction>(ArgumentTypeError_str), METH_NOARGS, nullptr},
+    {"__repr__", reinterpret_cast<PyCFunction>(ArgumentTypeError_repr), METH_NOARGS, nullptr},
+    {"__reduce__", reinterpret_cast<PyCFunction>(ArgumentTypeError_reduce), METH_NOARGS, nullptr},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+static PyGetSetDef ArgumentTypeError_getset[] = {
+    {const_cast<char *>("args"), ArgumentTypeError_get_args, ArgumentTypeError_set_args,
+     nullptr, nullptr},
+    {nullptr, nullptr, nullptr, nullptr, nullptr}
+};
+
+static PyTypeObject *createArgumentTypeError()
+{
+    // The type is created like a Python class, which takes care of the
+    // instance dict and deallocation of exception subclasses.
+    auto *type = PyErr_NewException("Shiboken.ArgumentTypeError", PyExc_TypeError, nullptr);
+    if (type == nullptr)
+        return nullptr;
+    auto *typeObject = reinterpret_cast<PyTypeObject *>(type);
+    for (auto *meth = ArgumentTypeError_methods; meth->ml_name != nullptr; ++meth) {
+        AutoDecRef descr(PyDescr_NewMethod(typeObject, meth));
+        if (descr.isNull() || PyObject_SetAttrString(type, meth->ml_name, descr) < 0)
+            return nullptr;
+    }
+    for (auto *getset = ArgumentTypeError_getset; getset->name != nullptr; ++getset) {
+        AutoDecRef descr(PyDescr_NewGetSet(typeObject, getset));
+        if (descr.isNull() || PyObject_SetAttrString(type, getset->name, descr) < 0)
+            return nullptr;
+    }
+    return typeObject;
+}
+
+PyTypeObject *SbkArgumentTypeError_TypeF(void)
+{
+    static PyTypeObject *type = nullptr;
+    if (type == nullptr) {
+        type = createArgumentTypeError();
+        if (type == nullptr)
+            PyErr_Clear();
+    }
+    return type;
+}
+
+// Returns whether the error for \a info is raised as ArgumentTypeError. This
+// is decided from \a info alone, without matching the signatures: wrong
+// argument types, argument counts and duplicate keyword arguments are
+// TypeErrors (see errorhandler.py). Arguments whose types match a signature,
+// for which seterror_argument() reports a ValueError, and function names
+// failing to evaluate are reported as ArgumentTypeError as well; only the
+// message tells them apart.
+static bool isArgumentTypeError(PyObject *info)
+{
+    if (info == nullptr || info == Py_None)
+        return true;
+    if (!PyUnicode_Check(info))
+        return false;
+    if (PyUnicode_CompareWithASCIIString(info, "<") == 0
+        || PyUnicode_CompareWithASCIIString(info, ">") == 0) {
+        return true;
+    }
+    AutoDecRef isAlnum(PyObject_CallMethod(info, "isalnum", nullptr));
+    if (isAlnum.isNull()) {
+        PyErr_Clear();
+        return false;
+    }
+    return isAlnum.object() == Py_True;
+}
+
+static bool setLazyArgumentError(PyObject *args, const char *func_name, PyObject *info)
+{
+    auto *type = reinterpret_cast<PyObject *>(SbkArgumentTypeError_TypeF());
+    if (type == nullptr)
+        return false;
+    AutoDecRef funcName(String::fromCString(func_name));
+    AutoDecRef selectId(PyLong_FromLong(callerSelectId()));
+    AutoDecRef data(PyTuple_Pack(4, funcName.object(), args != nullptr ? args : Py_None,
+                                 info != nullptr ? info : Py_None, selectId.object()));
+    AutoDecRef error(PyObject_CallObject(type, nullptr));
+    if (data.isNull() || error.isNull()
+        || PyObject_SetAttr(error, argumentErrorKey(), data) < 0) {
+        PyErr_Clear();
+        return false;
+    }
+    PyErr_SetObject(type, error);
+    return true;
+}
+
 void SetError_Argument(PyObject *args, const char *func_name, PyObject *info)
 {
+    // Errors about wrong argument types or counts are rendered lazily.
+    if (!PyErr_Occurred() && isArgumentTypeError(info)
+        && setLazyArgumentError(args, func_name, info)) {
+        return;
+    }
+
     init_shibokensupport_module();
     /*
      * This function replaces the type error construction with extra
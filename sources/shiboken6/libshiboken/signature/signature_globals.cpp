@@ -13,6 +13,7 @@
 #include "sbkstaticstrings.h"
 #include "sbkstaticstrings_p.h"
 #include "sbkenum.h"
+#include "sbkstatistics_p.h"
 
 #include "signature_p.h"
 
@@ -28,6 +29,43 @@ static const unsigned char PySide_SignatureLoader[] = {
 #include "embed/signature_bootstrap_inc.h"
     };
 
+struct PySideEmbeddedCode
+{
+    const char *name;
+    const char *filename;
+    const unsigned char *data;
+    Py_ssize_t size;
+};
+
+#include "embed/signature_code_inc.h"
+
+/*
+ * Pass the precompiled modules of the support package to the bootstrap
+ * loader as read-only memoryviews of the library's data. This avoids
+ * decoding, unzipping and compiling them in every process.
+ * Returns false if there is no code for the running interpreter.
+ */
+static bool setEmbeddedCode(PyObject *mdict)
+{
+    if (PySide_SignatureCode[0].name == nullptr
+        || PyImport_GetMagicNumber() != PySide_SignatureCodeMagic) {
+        return false;
+    }
+    AutoDecRef code_dict(PyDict_New());
+    if (code_dict.isNull())
+        return false;
+    for (const auto *entry = PySide_SignatureCode; entry->name != nullptr; ++entry) {
+        auto *data = reinterpret_cast<char *>(const_cast<unsigned char *>(entry->data));
+        AutoDecRef view(PyMemoryView_FromMemory(data, entry->size, PyBUF_READ));
+        if (view.isNull())
+            return false;
+        AutoDecRef value(Py_BuildValue("(sO)", entry->filename, view.object()));
+        if (value.isNull() || PyDict_SetItemString(code_dict, entry->name, value) < 0)
+            return false;
+    }
+    return PyDict_SetItemString(mdict, "embedded_code", code_dict) == 0;
+}
+
 static safe_globals_struc *init_phase_1()
 {
     do {
@@ -84,22 +122,27 @@ static safe_globals_struc *init_phase_1()
          * They will be loaded later with the zipimporter.
          * The file `signature_bootstrap.py` does the unpacking and starts the
          * loader. See `init_phase_2`.
+         * When the modules were precompiled for this interpreter, they are
+         * used instead and the ZIP file is not needed.
          *
          * Due to MSVC's limitation to 64k strings, we needed to assemble pieces.
          */
-        auto **block_ptr = reinterpret_cast<const char **>(PySide_CompressedSignaturePackage);
-        int npieces = 0;
-        PyObject *piece{};
-        AutoDecRef zipped_string_sequence(PyList_New(0));
-        for (; **block_ptr != 0; ++block_ptr) {
-            npieces++;
-            // we avoid the string/unicode dilemma by not using PyString_XXX:
-            piece = Py_BuildValue("s", *block_ptr);
-            if (piece == nullptr || PyList_Append(zipped_string_sequence, piece) < 0)
+        if (!setEmbeddedCode(mdict)) {
+            PyErr_Clear();
+            auto **block_ptr = reinterpret_cast<const char **>(PySide_CompressedSignaturePackage);
+            int npieces = 0;
+            PyObject *piece{};
+            AutoDecRef zipped_string_sequence(PyList_New(0));
+            for (; **block_ptr != 0; ++block_ptr) {
+                npieces++;
+                // we avoid the string/unicode dilemma by not using PyString_XXX:
+                piece = Py_BuildValue("s", *block_ptr);
+                if (piece == nullptr || PyList_Append(zipped_string_sequence, piece) < 0)
+                    break;
+            }
+            if (PyDict_SetItemString(mdict, "zipstring_sequence", zipped_string_sequence) < 0)
                 break;
         }
-        if (PyDict_SetItemString(mdict, "zipstring_sequence", zipped_string_sequence) < 0)
-            break;
 
         // build a dict for diverse mappings
         p->map_dict = PyDict_New();
@@ -236,6 +279,8 @@ void init_shibokensupport_module(void)
     static int init_done = 0;
 
     if (!init_done) {
+        Shiboken::Statistics::ScopedTimer timer(Shiboken::Statistics::SignatureInitNanoseconds);
+        SBK_TRACE(signature_init);
         pyside_globals = init_phase_1();
         if (pyside_globals != nullptr)
             init_done = 1;
@@ -35,6 +35,7 @@ void init_shibokensupport_module(void);
 // signature.cpp
 
 PyObject *GetTypeKey(PyObject *ob);
+PyTypeObject *SbkArgumentTypeError_TypeF(void);
 
 PyObject *GetSignature_Function(PyObject *, PyObject *);
 PyObject *GetSignature_TypeMod(PyObject *, PyObject *);
@@ -30,6 +30,8 @@ def getCppPointer(arg__1: Shiboken.Object) -> tuple[int, ...]: ...
 def invalidate(arg__1: Shiboken.Object) -> None: ...
 def isValid(arg__1: object) -> bool: ...
 def ownedByPython(arg__1: Shiboken.Object) -> bool: ...
+def resetStats() -> None: ...
+def stats() -> dict[str, int]: ...
 def wrapInstance(arg__1: int, arg__2: type) -> Shiboken.Object: ...
 
 
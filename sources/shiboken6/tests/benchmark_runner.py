@@ -0,0 +1,164 @@
+#!/usr/bin/env python
+# Copyright (C) 2022 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+'''Runner of the micro benchmarks of shiboken and PySide.
+
+A benchmark script registers its benchmarks with a Benchmarks instance and
+calls its main() function:
+
+    benchmarks = Benchmarks()
+
+    @benchmarks.register
+    def call(loops):
+        for _ in range(loops):
+            ...
+
+    sys.exit(benchmarks.main(__doc__, {"shiboken": Shiboken.__version__}))
+
+A benchmark receives the number of operations to run. For each benchmark,
+the time per operation and the number of memory blocks still allocated per
+operation after the run are reported. The latter should be zero; other
+values indicate leaks or growing state. CPython does not count
+allocations, so short-lived allocations are not visible.
+
+Benchmarks may be registered with a counter function, which is called once
+and returns a dict of named counts that are reported along with the
+timings, for example the size of state that grows per operation.'''
+
+import argparse
+import gc
+import json
+import platform
+import re
+import statistics
+import sys
+import time
+
+
+def calibrate(function, min_time):
+    '''Return the number of operations needed to run at least min_time seconds.'''
+    loops = 1
+    while True:
+        start = time.perf_counter()
+        function(loops)
+        if time.perf_counter() - start >= min_time or loops >= 1 << 30:
+            return loops
+        loops *= 2
+
+
+def allocated_blocks(function, loops):
+    '''Return the memory blocks still allocated per operation.'''
+    if not hasattr(sys, "getallocatedblocks"):  # PyPy
+        return None
+    gc.collect()
+    before = sys.getallocatedblocks()
+    function(loops)
+    gc.collect()
+    return (sys.getallocatedblocks() - before) / loops
+
+
+def run(function, repeat, min_time, counters=None):
+    loops = calibrate(function, min_time)
+    values = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        function(loops)
+        values.append((time.perf_counter() - start) / loops)
+    result = {"name": function.__name__,
+              "loops": loops,
+              "values": values,
+              "min": min(values),
+              "mean": statistics.mean(values),
+              "stdev": statistics.stdev(values) if len(values) > 1 else 0.0,
+              "blocks": allocated_blocks(function, loops)}
+    if counters is not None:
+        result["counters"] = counters()
+    return result
+
+
+def metadata(versions):
+    result = {"python": sys.version,
+              "implementation": platform.python_implementation(),
+              "platform": platform.platform()}
+    result.update(versions)
+    result["date"] = time.strftime("%Y-%m-%dT%H:%M:%S")
+    return result
+
+
+def format_result(result, width, base):
+    line = (f"{result['name']:{width}} {result['min'] * 1e9:12.1f} ns/op"
+            f" +- {result['stdev'] * 1e9:8.1f} ns")
+    if result["blocks"] is not None:
+        line += f" {result['blocks']:8.2f} blocks/op"
+    if result["name"] in base:
+        ratio = result["min"] / base[result["name"]]["min"]
+        line += f"   {ratio:6.3f}x"
+    for name, value in result.get("counters", {}).items():
+        line += f"   {name}={value:g}"
+    return line
+
+
+class Benchmarks:
+    '''A list of benchmarks and the command line runner.'''
+
+    def __init__(self):
+        self._functions = []
+        self._counters = {}
+
+    def register(self, function=None, counters=None):
+        '''Register a benchmark, usable as decorator with or without a
+        counter function.'''
+        def decorate(function):
+            self._functions.append(function)
+            if counters is not None:
+                self._counters[function.__name__] = counters
+            return function
+        return decorate(function) if function is not None else decorate
+
+    def main(self, description, versions, setup=None):
+        '''Parse the command line and run the benchmarks. versions is a dict
+        of the versions of the modules under test written to the metadata,
+        setup is called before running them.'''
+        parser = argparse.ArgumentParser(description=description,
+                                         formatter_class=argparse.RawDescriptionHelpFormatter)
+        parser.add_argument("--output", "-o", help="Write the results as JSON to this file")
+        parser.add_argument("--compare", "-c",
+                            help="JSON results of a previous run to compare to")
+        parser.add_argument("--filter", "-f",
+                            help="Run only the benchmarks matching this regular expression")
+        parser.add_argument("--repeat", "-r", type=int, default=5,
+                            help="Number of runs (default: 5)")
+        parser.add_argument("--min-time", type=float, default=0.1,
+                            help="Minimum duration of a run in seconds (default: 0.1)")
+        parser.add_argument("--list", "-l", action="store_true", help="List the benchmarks")
+        options = parser.parse_args()
+
+        functions = self._functions
+        if options.filter:
+            pattern = re.compile(options.filter)
+            functions = [f for f in functions if pattern.search(f.__name__)]
+        if options.list:
+            for f in functions:
+                print(f.__name__)
+            return 0
+
+        base = {}
+        if options.compare:
+            with open(options.compare) as f:
+                base = {b["name"]: b for b in json.load(f)["benchmarks"]}
+
+        if setup is not None:
+            setup()
+        width = max((len(f.__name__) for f in functions), default=0)
+        results = []
+        for f in functions:
+            result = run(f, options.repeat, options.min_time, self._counters.get(f.__name__))
+            results.append(result)
+            print(format_result(result, width, base), flush=True)
+
+        if options.output:
+            with open(options.output, "w") as f:
+                json.dump({"metadata": metadata(versions), "benchmarks": results}, f, indent=2)
+            print(f"Results written to {options.output}")
+        return 0
@@ -0,0 +1,196 @@
+#!/usr/bin/env python
+# Copyright (C) 2022 The Qt Company Ltd.
+# SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+'''Micro benchmarks of the shiboken runtime using the sample binding.
+
+Each benchmark exercises one hot path of libshiboken and the generated code:
+method calls, overload dispatch, virtual method overrides, value types,
+container and enum conversions and the wrapper lookup.
+
+The results are written as JSON with --output. Passing the JSON file of a
+previous run with --compare prints the relative timings, which helps to
+find regressions:
+
+    python sample_bench.py --output base.json
+    (change libshiboken)
+    python sample_bench.py --compare base.json
+
+Run it through the "shiboken_benchmarks" CMake target or with BUILD_DIR set
+as for the tests.'''
+
+import copy
+import os
+import sys
+
+from pathlib import Path
+sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
+from shiboken_paths import init_paths
+init_paths()
+
+from benchmark_runner import Benchmarks
+
+from shiboken6 import Shiboken
+from sample import (Derived, Event, ListUser, MapUser, ObjectType, Overload,
+                    Point, Time, VirtualDaughter, VirtualMethods)
+
+
+benchmarks = Benchmarks()
+
+
+class PyDerived(Derived):
+    def unpureVirtual(self):
+        pass
+
+
+class PyVirtualMethods(VirtualMethods):
+    pass
+
+
+class PyVirtualDaughter(VirtualDaughter):
+    pass
+
+
+@benchmarks.register
+def call_0_args(loops):
+    point = Point(1, 2)
+    for _ in range(loops):
+        point.x()
+
+
+@benchmarks.register
+def call_1_arg(loops):
+    point = Point(1, 2)
+    for _ in range(loops):
+        point.setX(3.0)
+
+
+@benchmarks.register
+def call_2_args(loops):
+    t = Time()
+    for _ in range(loops):
+        t.setTime(1, 2)
+
+
+@benchmarks.register
+def call_3_args(loops):
+    t = Time()
+    for _ in range(loops):
+        t.setTime(1, 2, 3)
+
+
+@benchmarks.register
+def call_4_args(loops):
+    t = Time()
+    for _ in range(loops):
+        t.setTime(1, 2, 3, 4)
+
+
+@benchmarks.register
+def call_5_args(loops):
+    overload = Overload()
+    for _ in range(loops):
+        overload.drawText3(1, 2, 3, 4, 5)
+
+
+@benchmarks.register
+def call_6_args(loops):
+    overload = Overload()
+    for _ in range(loops):
+        overload.drawText(1, 2, 3, 4, 5, "text")
+
+
+@benchmarks.register
+def overload_dispatch(loops):
+    '''Overloads differing in the argument count and types.'''
+    overload = Overload()
+    point = Point()
+    for _ in range(loops):
+        overload.overloaded()
+        overload.overloaded(point)
+        overload.intDoubleOverloads(1, 2)
+        overload.intDoubleOverloads(1.5, 2.5)
+
+
+@benchmarks.register
+def virtual_override(loops):
+    '''C++ to Python virtual calls into an overriding method.'''
+    derived = PyDerived()
+    for _ in range(loops):
+        derived.callUnpureVirtual()
+
+
+@benchmarks.register
+def virtual_not_overridden(loops):
+    '''Virtual calls on Python types which do not override the method, each
+    one looks up an override. The types alternate, which is the worst case
+    for a cache remembering only the last type.'''
+    first = PyVirtualMethods()
+    second = PyVirtualDaughter()
+    for i in range(loops):
+        first.callSum0(i, 1, 2)
+        second.callSum0(i, 1, 2)
+
+
+@benchmarks.register
+def value_type_construction(loops):
+    for _ in range(loops):
+        Point(1, 2)
+
+
+@benchmarks.register
+def value_type_copy(loops):
+    point = Point(1, 2)
+    for _ in range(loops):
+        copy.copy(point)
+
+
+@benchmarks.register
+def wrapper_lifetime(loops):
+    '''Creation and deallocation of object type wrappers.'''
+    for _ in range(loops):
+        ObjectType()
+        VirtualDaughter()
+
+
+@benchmarks.register
+def list_conversion(loops):
+    values = list(range(100))
+    user = ListUser()
+    for _ in range(loops):
+        user.setList(values)
+        user.getList()
+
+
+@benchmarks.register
+def map_conversion(loops):
+    values = {str(i): [i, i + 1] for i in range(20)}
+    user = MapUser()
+    for _ in range(loops):
+        user.setMap(values)
+        user.getMap()
+
+
+@benchmarks.register
+def enum_round_trip(loops):
+    event = Event(Event.NO_EVENT)
+    for _ in range(loops):
+        event.setEventType(Event.SOME_EVENT)
+        event.eventType()
+
+
+@benchmarks.register
+def wrapper_identity(loops):
+    '''Returning a C++ object which has a wrapper already.'''
+    parent = ObjectType()
+    child = ObjectType(parent)
+    for _ in range(loops):
+        child.parent()
+
+
+def main():
+    return benchmarks.main(__doc__, {"shiboken": Shiboken.__version__})
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -62,6 +62,25 @@ class OverflowTest(unittest.TestCase):
         self.assertRaises(OverflowError, doubleShort, 0xFFFF*-1)
         self.assertRaises(OverflowError, doubleShort, 0xFFFF + 1)
 
+    def testIntOverflow(self):
+        '''Calls function with int parameter using values at and beyond the limits.'''
+        self.assertEqual(acceptInt(-2**31), -2**31)
+        self.assertRaises(OverflowError, acceptInt, 2**31)
+        self.assertRaises(OverflowError, acceptInt, 2**70)
+
+    def testNumberSubclasses(self):
+        '''Subclasses of int and float are converted like the base types.'''
+        class MyInt(int):
+            pass
+
+        class MyFloat(float):
+            pass
+
+        self.assertEqual(acceptInt(MyInt(3)), 3)
+        self.assertEqual(acceptInt(True), 1)
+        self.assertEqual(acceptDouble(MyFloat(2.5)), 2.5)
+        self.assertEqual(acceptDouble(4), 4.0)
+
     def testOverflowOnCtor(self):
         '''Calls object ctor with int parameter using overflowing values.'''
         self.assertRaises(OverflowError, Point, 42415335332353253, 42415335332353253)
@@ -12,6 +12,7 @@ from pathlib import Path
 sys.path.append(os.fspath(Path(__file__).resolve().parents[1]))
 from shiboken_paths import init_paths
 init_paths()
+from shiboken6 import Shiboken
 from sample import Echo, Overload, Point, PointF, Polygon, Rect, RectF, Size, Str
 
 
@@ -22,7 +23,7 @@ def raisesWithErrorMessage(func, arguments, errorType, errorMsg):
         func(*arguments)
         return False
     except Exception as err:
-        if type(err) != TypeError:
+        if not isinstance(err, errorType):
             return False
         if not errorMsg in str(err):
             return False
@@ -137,6 +138,17 @@ class OverloadTest(unittest.TestCase):
                                         TypeError, 'called with wrong argument types:')
         self.assertTrue(result)
 
+    def testArgumentErrorMessage(self):
+        '''The message of an argument error is created when it is accessed.'''
+        overload = Overload()
+        with self.assertRaises(TypeError) as cm:
+            overload.drawText3(Str(), Str(), Str(), 4, 5)
+        err = cm.exception
+        self.assertIsInstance(err, Shiboken.ArgumentTypeError)
+        self.assertIn('called with wrong argument types:', str(err))
+        self.assertEqual(err.args, (str(err),))
+        self.assertIn('drawText3', repr(err))
+
     def testDrawText4(self):
         overload = Overload()
         self.assertEqual(overload.drawText4(1, 2, 3), Overload.Function0)
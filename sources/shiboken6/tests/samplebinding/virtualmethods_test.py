@@ -110,6 +110,38 @@ class VirtualMethodsTest(unittest.TestCase):
         self.assertTrue(eevd.grand_grand_daughter_name_called)
         self.assertEqual(eevd.name().prepend(self.prefix_from_codeinjection), name)
 
+    def testOverrideCache(self):
+        '''Test that the methods known not to be overridden are updated when
+        the type is modified.'''
+        class PlainVirtualMethods(VirtualMethods):
+            pass
+
+        objects = [PlainVirtualMethods() for _ in range(3)]
+        for o in objects:
+            self.assertEqual(o.callSum0(1, 2, 3), 6)
+
+        PlainVirtualMethods.sum0 = lambda self, a0, a1, a2: a0 * a1 * a2
+        objects.append(PlainVirtualMethods())
+        for o in objects:
+            self.assertEqual(o.callSum0(2, 3, 4), 24)
+
+        del PlainVirtualMethods.sum0
+        for o in objects:
+            self.assertEqual(o.callSum0(2, 3, 4), 9)
+
+    def testOverrideCacheMixin(self):
+        '''Test that methods assigned to a plain Python class in the MRO
+        are called for new instances.'''
+        class Mixin:
+            pass
+
+        class MixinVirtualMethods(Mixin, VirtualMethods):
+            pass
+
+        self.assertEqual(MixinVirtualMethods().callSum0(1, 2, 3), 6)
+        Mixin.sum0 = lambda self, a0, a1, a2: a0 * a1 * a2
+        self.assertEqual(MixinVirtualMethods().callSum0(2, 3, 4), 24)
+
     def testStringView(self):
         virtual_methods = VirtualMethods()
         self.assertEqual(virtual_methods.stringViewLength('bla'), 3)
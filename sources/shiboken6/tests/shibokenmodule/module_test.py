@@ -95,6 +95,22 @@ class TestShiboken(unittest.TestCase):
         Shiboken.delete(obj)
         self.assertFalse(obj in Shiboken.getAllValidWrappers())
 
+    def testStats(self):
+        stats = Shiboken.stats()
+        self.assertEqual(type(stats), dict)
+        if not stats:
+            return  # Built without SHIBOKEN_STATISTICS
+        Shiboken.resetStats()
+        parent = ObjectType()
+        child = ObjectType(parent)
+        for _ in range(10):
+            child.parent()
+        stats = Shiboken.stats()
+        self.assertTrue(stats["wrapper_map_lookups"] >= 10)
+        self.assertTrue(stats["wrappers"] >= 2)
+        Shiboken.resetStats()
+        self.assertEqual(Shiboken.stats()["wrapper_map_lookups"], 0)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -221,6 +221,20 @@ class SmartPointerTests(unittest.TestCase):
         except AttributeError as error:
             self.assertEqual(error.args[0], "'smart.SharedPtr_Obj' object has no attribute 'typo'")
 
+    def testPointeeAttributes(self):
+        ptrToObj = Obj.createSharedPtrObj()
+        # Attributes of the smart pointer itself take precedence.
+        self.assertTrue(callable(ptrToObj.data))
+        # An existing wrapper of the pointee is used for the attribute access.
+        obj = ptrToObj.data()
+        obj.pythonAttribute = 42
+        self.assertEqual(ptrToObj.pythonAttribute, 42)
+        self.assertEqual(ptrToObj.m_internalInteger.m_int, obj.m_internalInteger.m_int)
+        self.assertRaises(AttributeError, getattr, ptrToObj, "typo")
+
+        null_ptr = Obj.createNullSharedPtrInteger()
+        self.assertRaises(AttributeError, getattr, null_ptr, "value")
+
     def testSmartPointerConversions(self):
         # Create Obj.
         o = Obj()